@@ -104,9 +104,23 @@ void benchmark()
     std::cout << t << '\n';
     std::cout << result << '\n';
 
+    // The comprehension can also push its elements, running as nested loops:
     result = 0;
     int found = 0;
     t.reset();
+    for_each_until(triples, [&](std::tuple<int, int, int> triple)
+    {
+        int i, j, k;
+        std::tie(i, j, k) = triple;
+        result += (i + j + k);
+        return ++found != max_triples;
+    });
+    std::cout << t << '\n';
+    std::cout << result << '\n';
+
+    result = 0;
+    found = 0;
+    t.reset();
     for(int z = 1;; ++z)
     {
         for(int x = 1; x <= z; ++x)
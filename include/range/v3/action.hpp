@@ -20,6 +20,8 @@
 #include <range/v3/action/erase.hpp>
 #include <range/v3/action/remove_if.hpp>
 #include <range/v3/action/insert.hpp>
+#include <range/v3/action/nth_element.hpp>
+#include <range/v3/action/partial_sort.hpp>
 #include <range/v3/action/push_back.hpp>
 #include <range/v3/action/push_front.hpp>
 #include <range/v3/action/slice.hpp>
@@ -28,6 +30,7 @@
 #include <range/v3/action/stride.hpp>
 #include <range/v3/action/take.hpp>
 #include <range/v3/action/take_while.hpp>
+#include <range/v3/action/top_k.hpp>
 #include <range/v3/action/transform.hpp>
 #include <range/v3/action/unique.hpp>
 
@@ -14,17 +14,106 @@
 #ifndef RANGES_V3_CONTAINER_ACTION_HPP
 #define RANGES_V3_CONTAINER_ACTION_HPP
 
+#include <tuple>
+#include <utility>
 #include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/action/concepts.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/integer_sequence.hpp>
 #include <range/v3/utility/pipeable.hpp>
 
 namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            // An action with the arguments that follow the range bound to it. Unlike a
+            // std::bind expression, it can be taken apart again, so that an action fusion
+            // rule can see which action it is and with what arguments.
+            template<typename Action, typename...Ts>
+            struct bound_action
+            {
+                Action fn;
+                std::tuple<Ts...> args;
+            private:
+                template<typename Rng, std::size_t...Is>
+                auto call(Rng && rng, index_sequence<Is...>) const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    fn(std::forward<Rng>(rng), std::get<Is>(args)...)
+                )
+            public:
+                template<typename Rng>
+                auto operator()(Rng && rng) const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    this->call(std::forward<Rng>(rng), make_index_sequence<sizeof...(Ts)>{})
+                )
+            };
+
+            template<typename Action, typename...Ts>
+            bound_action<Action, Ts...> bind_action(Action fn, Ts...ts)
+            {
+                return {std::move(fn), std::tuple<Ts...>{std::move(ts)...}};
+            }
+
+            // Two actions, done one after the other.
+            template<typename Action0, typename Action1>
+            struct action_seq
+            {
+                Action0 first;
+                Action1 second;
+                template<typename Rng>
+                auto operator()(Rng && rng) const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    second(first(std::forward<Rng>(rng)))
+                )
+            };
+
+            // Adjacent actions are fused into one that does the work of both in fewer
+            // passes if there is a fuse_actions rule for them, found by ADL; rules are
+            // defined next to the later of the two actions. The last action of a
+            // sequence can be fused with the one that follows it. Otherwise, the actions
+            // are done in turn.
+            template<typename Action0, typename Action1>
+            auto fuse_actions_(Action0 a0, Action1 a1, int)
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                fuse_actions(std::move(a0), std::move(a1))
+            )
+
+            template<typename Action0, typename Action1, typename Action2>
+            auto fuse_actions_(action_seq<Action0, Action1> a01, Action2 a2, int) ->
+                action_seq<Action0,
+                    decltype(fuse_actions(std::declval<Action1>(), std::declval<Action2>()))>
+            {
+                return {std::move(a01.first),
+                    fuse_actions(std::move(a01.second), std::move(a2))};
+            }
+
+            template<typename Action0, typename Action1>
+            action_seq<Action0, Action1> fuse_actions_(Action0 a0, Action1 a1, long)
+            {
+                return {std::move(a0), std::move(a1)};
+            }
+
+            template<typename T>
+            struct is_action_
+              : std::false_type
+            {};
+
+            template<typename Action>
+            struct is_action_<action::action<Action>>
+              : std::true_type
+            {};
+        }
+        /// \endcond
+
         /// \addtogroup group-actions
         /// @{
         namespace action
@@ -62,6 +151,8 @@ namespace ranges
             private:
                 Action action_;
                 friend pipeable_access;
+                template<typename A>
+                friend struct action;
                 template<typename Rng>
                 using ActionPipeConcept = meta::and_<
                     Function<Action, Rng>,
@@ -75,6 +166,25 @@ namespace ranges
                 (
                     act.action_(std::move(rng))
                 )
+                // Composing two actions makes an action that does the one and then the
+                // other, fused into a single action where there is a rule for the pair,
+                // like `sort | take(n)`, which only needs a partial sort.
+                template<typename Act0, typename Act1,
+                    CONCEPT_REQUIRES_(detail::is_action_<uncvref_t<Act1>>())>
+                static auto compose(Act0 && act0, Act1 && act1)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_action(detail::fuse_actions_(std::forward<Act0>(act0).action_,
+                        std::forward<Act1>(act1).action_, 0))
+                )
+                template<typename Act0, typename Pipe1,
+                    CONCEPT_REQUIRES_(!detail::is_action_<uncvref_t<Pipe1>>())>
+                static auto compose(Act0 && act0, Pipe1 && pipe1)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    pipeable_access::impl<pipeable<action>>::compose(
+                        std::forward<Act0>(act0), std::forward<Pipe1>(pipe1))
+                )
             #ifndef RANGES_DOXYGEN_INVOKED
                 // For better error messages:
                 template<typename Rng, typename Act,
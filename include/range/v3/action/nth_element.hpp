@@ -0,0 +1,121 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_ACTION_NTH_ELEMENT_HPP
+#define RANGES_V3_ACTION_NTH_ELEMENT_HPP
+
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/action/action.hpp>
+#include <range/v3/algorithm/nth_element.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-actions
+        /// @{
+        namespace action
+        {
+            /// Puts the element that would be at position `n` of the sorted range there,
+            /// with none of the elements before it greater and none after it less, in
+            /// linear time. If `n` is past the end, the range is left as it is.
+            struct nth_element_fn
+            {
+            private:
+                friend action_access;
+                template<typename Int, typename C = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(Integral<Int>())>
+                static auto bind(nth_element_fn nth_element, Int n, C pred = C{},
+                    P proj = P{})
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    detail::bind_action(nth_element, n, std::move(pred), std::move(proj))
+                )
+            public:
+                struct ConceptImpl
+                {
+                    template<typename Rng, typename T, typename C = ordered_less,
+                        typename P = ident,
+                        typename I = range_iterator_t<Rng>,
+                        typename D = range_difference_t<Rng>>
+                    auto requires_(Rng rng, T n, C pred = C{}, P proj = P{}) -> decltype(
+                        concepts::valid_expr(
+                            concepts::model_of<concepts::RandomAccessIterable, Rng>(),
+                            concepts::model_of<concepts::Convertible, T, D>(),
+                            concepts::is_true(Sortable<I, C, P>())
+                        ));
+                };
+
+                template<typename Rng, typename T, typename C = ordered_less,
+                    typename P = ident>
+                using Concept = concepts::models<ConceptImpl, Rng, T, C, P>;
+
+                template<typename Rng, typename C = ordered_less, typename P = ident,
+                    typename D = range_difference_t<Rng>,
+                    CONCEPT_REQUIRES_(Concept<Rng, D, C, P>())>
+                Rng operator()(Rng && rng, range_difference_t<Rng> n, C pred = C{},
+                    P proj = P{}) const
+                {
+                    RANGES_ASSERT(n >= 0);
+                    ranges::nth_element(rng, next_bounded(begin(rng), n, end(rng)),
+                        std::move(pred), std::move(proj));
+                    return std::forward<Rng>(rng);
+                }
+
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename T, typename C = ordered_less,
+                    typename P = ident,
+                    CONCEPT_REQUIRES_(!Concept<Rng, T, C, P>())>
+                void operator()(Rng &&, T &&, C && = C{}, P && = P{}) const
+                {
+                    CONCEPT_ASSERT_MSG(RandomAccessIterable<Rng>(),
+                        "The object on which action::nth_element operates must be a model "
+                        "of the RandomAccessIterable concept.");
+                    CONCEPT_ASSERT_MSG(Convertible<T, range_difference_t<Rng>>(),
+                        "The position argument to action::nth_element must be convertible to "
+                        "the range's difference type.");
+                    using I = range_iterator_t<Rng>;
+                    using V = iterator_common_reference_t<I>;
+                    CONCEPT_ASSERT_MSG(Invokable<P, V>(),
+                        "The projection argument passed to action::nth_element must accept "
+                        "objects of the range's common reference type.");
+                    using X = concepts::Invokable::result_t<P, V>;
+                    CONCEPT_ASSERT_MSG(InvokableRelation<C, X, X>(),
+                        "The comparator passed to action::nth_element must accept objects "
+                        "returned by the projection function, or of the range's value type "
+                        "if no projection is specified.");
+                    CONCEPT_ASSERT_MSG(Permutable<I>(),
+                        "The iterator type of the range passed to action::nth_element must "
+                        "allow its elements to be permuted; that is, the values must be "
+                        "movable and the iterator must be mutable.");
+                }
+            #endif
+            };
+
+            /// \ingroup group-actions
+            /// \relates nth_element_fn
+            /// \sa `action`
+            constexpr action<nth_element_fn> nth_element{};
+        }
+        /// @}
+    }
+}
+
+#endif
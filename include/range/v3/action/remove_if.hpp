@@ -40,8 +40,7 @@ namespace ranges
                 static auto bind(remove_if_fn remove_if, C pred, P proj = P{})
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
-                    std::bind(remove_if, std::placeholders::_1, protect(std::move(pred)),
-                        protect(std::move(proj)))
+                    detail::bind_action(remove_if, std::move(pred), std::move(proj))
                 )
             public:
                 struct ConceptImpl
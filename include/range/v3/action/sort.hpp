@@ -14,7 +14,6 @@
 #ifndef RANGES_V3_ACTION_SORT_HPP
 #define RANGES_V3_ACTION_SORT_HPP
 
-#include <functional>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/action/action.hpp>
 #include <range/v3/algorithm/sort.hpp>
@@ -38,8 +37,7 @@ namespace ranges
                 static auto bind(sort_fn sort, C pred, P proj = P{})
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
-                    std::bind(sort, std::placeholders::_1, protect(std::move(pred)),
-                        protect(std::move(proj)))
+                    detail::bind_action(sort, std::move(pred), std::move(proj))
                 )
             public:
                 struct ConceptImpl
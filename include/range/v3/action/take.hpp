@@ -14,10 +14,13 @@
 #ifndef RANGES_V3_ACTION_TAKE_HPP
 #define RANGES_V3_ACTION_TAKE_HPP
 
-#include <functional>
+#include <tuple>
+#include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/action/action.hpp>
 #include <range/v3/action/erase.hpp>
+#include <range/v3/action/sort.hpp>
+#include <range/v3/algorithm/partial_sort.hpp>
 #include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
@@ -39,7 +42,7 @@ namespace ranges
                 static auto bind(take_fn take, Int n)
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
-                    std::bind(take, std::placeholders::_1, n)
+                    detail::bind_action(take, n)
                 )
             public:
                 struct ConceptImpl
@@ -91,6 +94,53 @@ namespace ranges
             /// \relates take_fn
             /// \sa action
             constexpr action<take_fn> take{};
+
+            /// \cond
+            // sort followed by take(n) needs only the n least elements, in order, which
+            // a partial sort finds without ordering the rest.
+            template<typename C, typename P, typename Int>
+            struct sort_take_fn
+            {
+                C pred;
+                P proj;
+                Int n;
+
+                template<typename Rng, typename D = range_difference_t<Rng>,
+                    CONCEPT_REQUIRES_(RandomAccessIterable<Rng>() &&
+                        sort_fn::Concept<Rng, C, P>() && take_fn::Concept<Rng, D>())>
+                Rng operator()(Rng && rng) const
+                {
+                    RANGES_ASSERT(n >= 0);
+                    auto middle = next_bounded(begin(rng), static_cast<D>(n), end(rng));
+                    ranges::partial_sort(rng, middle, pred, proj);
+                    ranges::action::erase(rng, middle, end(rng));
+                    return std::forward<Rng>(rng);
+                }
+
+                template<typename Rng, CONCEPT_REQUIRES_(!RandomAccessIterable<Rng>())>
+                auto operator()(Rng && rng) const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    take_fn{}(sort_fn{}(std::forward<Rng>(rng), pred, proj), n)
+                )
+            };
+
+            template<typename Int>
+            sort_take_fn<ordered_less, ident, Int>
+            fuse_actions(sort_fn, detail::bound_action<take_fn, Int> take)
+            {
+                return {ordered_less{}, ident{}, std::get<0>(take.args)};
+            }
+
+            template<typename C, typename P, typename Int>
+            sort_take_fn<C, P, Int>
+            fuse_actions(detail::bound_action<sort_fn, C, P> sort,
+                detail::bound_action<take_fn, Int> take)
+            {
+                return {std::move(std::get<0>(sort.args)), std::move(std::get<1>(sort.args)),
+                    std::get<0>(take.args)};
+            }
+            /// \endcond
         }
         /// @}
     }
@@ -0,0 +1,124 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_ACTION_TOP_K_HPP
+#define RANGES_V3_ACTION_TOP_K_HPP
+
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/action/action.hpp>
+#include <range/v3/action/erase.hpp>
+#include <range/v3/algorithm/partial_sort.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-actions
+        /// @{
+        namespace action
+        {
+            /// Keeps the `k` greatest elements of a range by `proj`, greatest first, and
+            /// erases the rest. It partial-sorts the range in descending order, in
+            /// O(N + k log k) time, where `action::sort | action::take(k)` would sort all
+            /// of it.
+            struct top_k_fn
+            {
+            private:
+                friend action_access;
+                template<typename Int, typename P = ident, CONCEPT_REQUIRES_(Integral<Int>())>
+                static auto bind(top_k_fn top_k, Int k, P proj = P{})
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    detail::bind_action(top_k, k, std::move(proj))
+                )
+            public:
+                struct ConceptImpl
+                {
+                    template<typename Rng, typename T, typename P = ident,
+                        typename I = range_iterator_t<Rng>,
+                        typename S = range_sentinel_t<Rng>,
+                        typename D = range_difference_t<Rng>>
+                    auto requires_(Rng rng, T k, P proj = P{}) -> decltype(
+                        concepts::valid_expr(
+                            concepts::model_of<concepts::RandomAccessIterable, Rng>(),
+                            concepts::model_of<concepts::EraseableIterable, Rng, I, S>(),
+                            concepts::model_of<concepts::Convertible, T, D>(),
+                            concepts::is_true(Sortable<I, ordered_greater, P>())
+                        ));
+                };
+
+                template<typename Rng, typename T, typename P = ident>
+                using Concept = concepts::models<ConceptImpl, Rng, T, P>;
+
+                template<typename Rng, typename P = ident,
+                    typename D = range_difference_t<Rng>,
+                    CONCEPT_REQUIRES_(Concept<Rng, D, P>())>
+                Rng operator()(Rng && rng, range_difference_t<Rng> k, P proj = P{}) const
+                {
+                    RANGES_ASSERT(k >= 0);
+                    auto middle = next_bounded(begin(rng), k, end(rng));
+                    ranges::partial_sort(rng, middle, ordered_greater{}, std::move(proj));
+                    ranges::action::erase(rng, middle, end(rng));
+                    return std::forward<Rng>(rng);
+                }
+
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename T, typename P = ident,
+                    CONCEPT_REQUIRES_(!Concept<Rng, T, P>())>
+                void operator()(Rng &&, T &&, P && = P{}) const
+                {
+                    CONCEPT_ASSERT_MSG(RandomAccessIterable<Rng>(),
+                        "The object on which action::top_k operates must be a model of the "
+                        "RandomAccessIterable concept.");
+                    using I = range_iterator_t<Rng>;
+                    using S = range_sentinel_t<Rng>;
+                    CONCEPT_ASSERT_MSG(EraseableIterable<Rng, I, S>(),
+                        "The object on which action::top_k operates must allow element "
+                        "removal.");
+                    CONCEPT_ASSERT_MSG(Convertible<T, range_difference_t<Rng>>(),
+                        "The count argument to action::top_k must be convertible to the "
+                        "range's difference type.");
+                    using V = iterator_common_reference_t<I>;
+                    CONCEPT_ASSERT_MSG(Invokable<P, V>(),
+                        "The projection argument passed to action::top_k must accept objects "
+                        "of the range's common reference type.");
+                    using X = concepts::Invokable::result_t<P, V>;
+                    CONCEPT_ASSERT_MSG(TotallyOrdered<X>(),
+                        "The objects returned by the projection function passed to "
+                        "action::top_k, or the range's elements if no projection is "
+                        "specified, must be totally ordered.");
+                    CONCEPT_ASSERT_MSG(Permutable<I>(),
+                        "The iterator type of the range passed to action::top_k must allow "
+                        "its elements to be permuted; that is, the values must be movable and "
+                        "the iterator must be mutable.");
+                }
+            #endif
+            };
+
+            /// \ingroup group-actions
+            /// \relates top_k_fn
+            /// \sa `action`
+            constexpr action<top_k_fn> top_k{};
+        }
+        /// @}
+    }
+}
+
+#endif
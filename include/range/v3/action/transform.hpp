@@ -14,11 +14,15 @@
 #ifndef RANGES_V3_ACTION_TRANSFORM_HPP
 #define RANGES_V3_ACTION_TRANSFORM_HPP
 
-#include <functional>
+#include <tuple>
+#include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/action/action.hpp>
+#include <range/v3/action/erase.hpp>
+#include <range/v3/action/remove_if.hpp>
 #include <range/v3/algorithm/transform.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/invokable.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 
@@ -38,8 +42,7 @@ namespace ranges
                 static auto bind(transform_fn transform, F fun, P proj = P{})
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
-                    std::bind(transform, std::placeholders::_1, protect(std::move(fun)),
-                        protect(std::move(proj)))
+                    detail::bind_action(transform, std::move(fun), std::move(proj))
                 )
             public:
                 struct ConceptImpl
@@ -93,6 +96,51 @@ namespace ranges
             /// \relates transform_fn
             /// \sa action
             constexpr action<transform_fn> transform{};
+
+            /// \cond
+            // remove_if followed by transform, in one pass: each element that is kept
+            // is transformed as it is moved into place.
+            template<typename C, typename P0, typename F, typename P1>
+            struct remove_if_transform_fn
+            {
+                C pred;
+                P0 pred_proj;
+                F fun;
+                P1 fun_proj;
+
+                template<typename Rng, typename I = range_iterator_t<Rng>,
+                    CONCEPT_REQUIRES_(remove_if_fn::Concept<Rng, C, P0>() &&
+                        transform_fn::Concept<Rng, F, P1>())>
+                Rng operator()(Rng && rng) const
+                {
+                    auto &&pr = invokable(pred);
+                    auto &&pr_proj = invokable(pred_proj);
+                    auto &&fn = invokable(fun);
+                    auto &&fn_proj = invokable(fun_proj);
+                    I out = begin(rng);
+                    for(I it = out, e = end(rng); it != e; ++it)
+                    {
+                        if(pr(pr_proj(*it)))
+                            continue;
+                        *out = fn(fn_proj(*it));
+                        ++out;
+                    }
+                    ranges::action::erase(rng, out, end(rng));
+                    return std::forward<Rng>(rng);
+                }
+            };
+
+            template<typename C, typename P0, typename F, typename P1>
+            remove_if_transform_fn<C, P0, F, P1>
+            fuse_actions(detail::bound_action<remove_if_fn, C, P0> remove_if,
+                detail::bound_action<transform_fn, F, P1> transform)
+            {
+                return {std::move(std::get<0>(remove_if.args)),
+                    std::move(std::get<1>(remove_if.args)),
+                    std::move(std::get<0>(transform.args)),
+                    std::move(std::get<1>(transform.args))};
+            }
+            /// \endcond
         }
         /// @}
     }
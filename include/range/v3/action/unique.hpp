@@ -14,17 +14,106 @@
 #ifndef RANGES_V3_ACTION_UNIQUE_HPP
 #define RANGES_V3_ACTION_UNIQUE_HPP
 
+#include <cstddef>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
 #include <range/v3/action/action.hpp>
 #include <range/v3/action/erase.hpp>
+#include <range/v3/action/sort.hpp>
+#include <range/v3/algorithm/move.hpp>
+#include <range/v3/algorithm/sort.hpp>
 #include <range/v3/algorithm/unique.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/flat_hash_table.hpp>
 
 namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            // How many elements hash_unique samples to guess how many distinct values
+            // there are.
+            constexpr std::ptrdiff_t hash_unique_sample()
+            {
+                return 1024;
+            }
+
+            // The entries of hash_unique's set are positions in the prefix of unique
+            // elements, so that the elements aren't copied into it.
+            struct prefix_position
+            {
+                std::ptrdiff_t pos;
+                template<typename T>
+                prefix_position(T const &, std::ptrdiff_t p)
+                  : pos(p)
+                {}
+            };
+
+            template<typename I>
+            struct prefix_element
+            {
+                I begin;
+                iterator_reference_t<I> operator()(prefix_position p) const
+                {
+                    return begin[p.pos];
+                }
+            };
+
+            // Moves the first of each value in [begin, end) to the front, keeping the
+            // rest of the elements if it stops early, and returns the end of what it
+            // kept. Equal values of the types it is used for can't be told apart, so
+            // the elements kept are as good as sorted and uniqued ones. It hashes only
+            // if a sample of the elements says there are at most a quarter as many
+            // values as elements, and gives up if there turn out to be more.
+            template<typename I>
+            I hash_unique(I begin, I end)
+            {
+                using V = iterator_value_t<I>;
+                using D = iterator_difference_t<I>;
+                D const n = end - begin, s = hash_unique_sample();
+                if(n < 4 * s)
+                    return end;
+                // Of s elements drawn from u values, about s*s/2u repeat an earlier one.
+                flat_hash_table<V> sample;
+                sample.reserve(static_cast<std::size_t>(s));
+                for(D i = 0; i < s; ++i)
+                    sample.emplace(begin[i * (n / s)]);
+                if((s - static_cast<D>(sample.size())) * n <= 2 * s * s)
+                    return end;
+
+                flat_hash_table<prefix_position, prefix_element<I>> set{
+                    prefix_element<I>{begin}};
+                I out = begin;
+                for(I it = begin; it != end; ++it)
+                {
+                    if(!set.emplace(*it, out - begin).second)
+                        continue;
+                    if(out != it)
+                        *out = iter_move(it);
+                    ++out;
+                    if(static_cast<D>(set.size()) > n / 4)
+                        return ranges::move(next(it), end, out).second;
+                }
+                return out;
+            }
+
+            template<typename Rng, typename I = range_iterator_t<Rng>,
+                typename V = iterator_value_t<I>>
+            using hash_unique_t = meta::and_<
+                RandomAccessIterable<Rng>,
+                BoundedIterable<Rng>,
+                std::is_same<iterator_reference_t<I>, V &>,
+                is_std_hashable<V>>;
+        }
+        /// \endcond
+
         /// \addtogroup group-actions
         /// @{
         namespace action
@@ -34,11 +123,10 @@ namespace ranges
             private:
                 friend action_access;
                 template<typename C, typename P = ident, CONCEPT_REQUIRES_(!Iterable<C>())>
-                static auto bind(sort_fn sort, C pred, P proj = P{})
+                static auto bind(unique_fn unique, C pred, P proj = P{})
                 RANGES_DECLTYPE_AUTO_RETURN
                 (
-                    std::bind(sort, std::placeholders::_1, protect(std::move(pred)),
-                        protect(std::move(proj)))
+                    detail::bind_action(unique, std::move(pred), std::move(proj))
                 )
             public:
                 struct ConceptImpl
@@ -101,6 +189,42 @@ namespace ranges
             /// \relates unique_fn
             /// \sa action
             constexpr action<unique_fn> unique{};
+
+            /// \cond
+            // sort followed by unique. When there are many duplicates, it is quicker to
+            // drop them with a hash set first and sort only what is left.
+            struct sort_unique_fn
+            {
+            private:
+                template<typename Rng>
+                static void impl(Rng & rng, std::false_type)
+                {
+                    ranges::sort(rng);
+                    ranges::erase(rng, ranges::unique(rng), end(rng));
+                }
+                template<typename Rng, typename I = range_iterator_t<Rng>>
+                static void impl(Rng & rng, std::true_type)
+                {
+                    I begin = ranges::begin(rng);
+                    I end = detail::hash_unique(begin, ranges::end(rng));
+                    ranges::sort(begin, end);
+                    ranges::erase(rng, ranges::unique(begin, end), ranges::end(rng));
+                }
+            public:
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(sort_fn::Concept<Rng>() && unique_fn::Concept<Rng>())>
+                Rng operator()(Rng && rng) const
+                {
+                    sort_unique_fn::impl(rng, detail::hash_unique_t<Rng>{});
+                    return std::forward<Rng>(rng);
+                }
+            };
+
+            inline sort_unique_fn fuse_actions(sort_fn, unique_fn)
+            {
+                return {};
+            }
+            /// \endcond
         }
         /// @}
     }
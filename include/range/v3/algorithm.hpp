@@ -28,15 +28,18 @@
 #include <range/v3/algorithm/count_if.hpp>
 #include <range/v3/algorithm/equal.hpp>
 #include <range/v3/algorithm/equal_range.hpp>
+#include <range/v3/algorithm/eytzinger.hpp>
 #include <range/v3/algorithm/fill.hpp>
 #include <range/v3/algorithm/find.hpp>
 #include <range/v3/algorithm/find_end.hpp>
 #include <range/v3/algorithm/find_first_of.hpp>
+#include <range/v3/algorithm/find_first_not_of.hpp>
 #include <range/v3/algorithm/find_if.hpp>
 #include <range/v3/algorithm/find_if_not.hpp>
 #include <range/v3/algorithm/for_each.hpp>
 #include <range/v3/algorithm/generate.hpp>
 #include <range/v3/algorithm/generate_n.hpp>
+#include <range/v3/algorithm/group_aggregate.hpp>
 #include <range/v3/algorithm/heap_algorithm.hpp>
 #include <range/v3/algorithm/inplace_merge.hpp>
 #include <range/v3/algorithm/is_partitioned.hpp>
@@ -71,6 +74,7 @@
 #include <range/v3/algorithm/reverse_copy.hpp>
 #include <range/v3/algorithm/rotate.hpp>
 #include <range/v3/algorithm/rotate_copy.hpp>
+#include <range/v3/algorithm/sample.hpp>
 #include <range/v3/algorithm/search.hpp>
 #include <range/v3/algorithm/search_n.hpp>
 #include <range/v3/algorithm/set_algorithm.hpp>
@@ -86,10 +90,13 @@
 
 // BUGBUG
 #include <range/v3/algorithm/aux_/equal_range_n.hpp>
+#include <range/v3/algorithm/aux_/gallop_lower_bound.hpp>
+#include <range/v3/algorithm/aux_/gallop_upper_bound.hpp>
 #include <range/v3/algorithm/aux_/lower_bound_n.hpp>
 #include <range/v3/algorithm/aux_/merge_n.hpp>
 #include <range/v3/algorithm/aux_/merge_n_with_buffer.hpp>
 #include <range/v3/algorithm/aux_/sort_n_with_buffer.hpp>
+#include <range/v3/algorithm/aux_/stable_sort_n.hpp>
 #include <range/v3/algorithm/aux_/upper_bound_n.hpp>
 
 #include <range/v3/detail/re_enable_warnings.hpp>
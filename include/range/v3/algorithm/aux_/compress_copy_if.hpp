@@ -0,0 +1,96 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_AUX_COMPRESS_COPY_IF_HPP
+#define RANGES_V3_ALGORITHM_AUX_COMPRESS_COPY_IF_HPP
+
+#include <memory>
+#include <algorithm>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/concepts.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/algorithm/aux_/prefetch.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Iterators known to point into an array of numbers
+            template<typename I>
+            using is_contiguous_number_iterator = meta::and_<
+                std::is_arithmetic<iterator_value_t<I>>,
+                is_contiguous_iterator<I>>;
+        }
+        /// \endcond
+
+        namespace aux
+        {
+            /// Whether copy_if and remove_copy_if can filter `[I, S)` with
+            /// `compress_copy_if`: a contiguous range of numbers, not projected.
+            template<typename I, typename S, typename P>
+            using Compressible = meta::fast_and<
+                Same<I, S>,
+                Same<P, ident>,
+                detail::is_contiguous_number_iterator<I>>;
+
+            struct compress_copy_if_fn
+            {
+                /// Copies to `out` the elements of the `n` starting at `begin` for which
+                /// `pred` returns `keep`. They are filtered a block at a time: every
+                /// element is stored to a buffer whose end advances only past those to be
+                /// kept, so there is no branch on `pred` to mispredict, and the buffer is
+                /// then copied out in one tight loop. For the common case of numbers
+                /// passing a threshold test about half the time, that is several times
+                /// faster than branching on each element.
+                template<typename I, typename O, typename F,
+                    CONCEPT_REQUIRES_(Compressible<I, I, ident>())>
+                O operator()(I begin, iterator_difference_t<I> n, O out, F &pred,
+                    bool keep) const
+                {
+                    using V = iterator_value_t<I>;
+                    using D = iterator_difference_t<I>;
+                    static constexpr D block = 256;
+                    if(n <= 0)
+                        return out;
+                    auto p = std::addressof(*begin);
+                    V buf[block];
+                    for(; n > 0; n -= block, p += block)
+                    {
+                        D const m = (std::min)(n, block);
+                        D k = 0;
+                        for(D i = 0; i < m; ++i)
+                        {
+                            // pred sees the element itself, and may take it by
+                            // non-const reference.
+                            bool const b = static_cast<bool>(pred(p[i])) == keep;
+                            buf[k] = p[i];
+                            k += b;
+                        }
+                        for(D i = 0; i < k; ++i, ++out)
+                            *out = buf[i];
+                    }
+                    return out;
+                }
+            };
+
+            constexpr compress_copy_if_fn compress_copy_if {};
+        }
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -35,7 +35,7 @@ namespace ranges
             struct equal_range_n_fn
             {
                 template<typename I, typename V, typename R = ordered_less, typename P = ident,
-                    CONCEPT_REQUIRES_(BinarySearchable<I, V, R, P>())>
+                    CONCEPT_REQUIRES_(!RandomAccessIterator<I>() && BinarySearchable<I, V, R, P>())>
                 range<I>
                 operator()(I begin, iterator_difference_t<I> dist, V const & val, R pred_ = R{},
                     P proj_ = P{}) const
@@ -62,6 +62,20 @@ namespace ranges
                     }
                     return {begin, begin};
                 }
+
+                // For random-access iterators, two branchless searches beat one branchy
+                // three-way search.
+                template<typename I, typename V, typename R = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(RandomAccessIterator<I>() && BinarySearchable<I, V, R, P>())>
+                range<I>
+                operator()(I begin, iterator_difference_t<I> dist, V const & val, R pred = R{},
+                    P proj = P{}) const
+                {
+                    RANGES_ASSERT(0 <= dist);
+                    I lo = lower_bound_n(begin, dist, val, pred, proj);
+                    return {lo, upper_bound_n(lo, dist - (lo - begin), val, std::move(pred),
+                        std::move(proj))};
+                }
             };
 
             constexpr equal_range_n_fn equal_range_n{};
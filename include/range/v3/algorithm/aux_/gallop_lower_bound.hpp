@@ -0,0 +1,80 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_AUX_GALLOP_LOWER_BOUND_HPP
+#define RANGES_V3_ALGORITHM_AUX_GALLOP_LOWER_BOUND_HPP
+
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/invokable.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/algorithm/aux_/lower_bound_n.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace aux
+        {
+            // Like lower_bound, but the cost is logarithmic in the distance from begin to
+            // the result rather than in the size of the whole range. Probes positions 1, 2,
+            // 4, 8, ... until one is not less than val, then binary searches the last gap.
+            // Iterators that can't jump fall back to a linear scan, which is the best they
+            // can do anyway.
+            struct gallop_lower_bound_fn
+            {
+                template<typename I, typename S, typename V2, typename C = ordered_less,
+                    typename P = ident,
+                    CONCEPT_REQUIRES_(RandomAccessIterator<I>() && SizedIteratorRange<I, S>() &&
+                        BinarySearchable<I, V2, C, P>())>
+                I operator()(I begin, S end, V2 const &val, C pred_ = C{}, P proj_ = P{}) const
+                {
+                    auto &&pred = invokable(pred_);
+                    auto &&proj = invokable(proj_);
+                    iterator_difference_t<I> const d = end - begin;
+                    if(0 == d || !pred(proj(*begin), val))
+                        return begin;
+                    // Invariant: proj(begin[lo]) < val
+                    iterator_difference_t<I> lo = 0, step = 1;
+                    while(step < d - lo && pred(proj(*(begin + (lo + step))), val))
+                    {
+                        lo += step;
+                        step *= 2;
+                    }
+                    iterator_difference_t<I> hi = step < d - lo ? lo + step : d;
+                    return aux::lower_bound_n(begin + (lo + 1), hi - (lo + 1), val,
+                        std::move(pred_), std::move(proj_));
+                }
+
+                template<typename I, typename S, typename V2, typename C = ordered_less,
+                    typename P = ident,
+                    typename X = concepts::Invokable::result_t<P, iterator_common_reference_t<I>>,
+                    CONCEPT_REQUIRES_(!(RandomAccessIterator<I>() && SizedIteratorRange<I, S>()) &&
+                        IteratorRange<I, S>() && InvokablePredicate<C, X, V2 const &>())>
+                I operator()(I begin, S end, V2 const &val, C pred_ = C{}, P proj_ = P{}) const
+                {
+                    auto &&pred = invokable(pred_);
+                    auto &&proj = invokable(proj_);
+                    for(; begin != end && pred(proj(*begin), val); ++begin)
+                        ;
+                    return begin;
+                }
+            };
+
+            constexpr gallop_lower_bound_fn gallop_lower_bound{};
+        }
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
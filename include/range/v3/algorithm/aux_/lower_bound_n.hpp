@@ -19,7 +19,9 @@
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/algorithm/aux_/prefetch.hpp>
 
 namespace ranges
 {
@@ -30,7 +32,7 @@ namespace ranges
             struct lower_bound_n_fn
             {
                 template<typename I, typename V2, typename C = ordered_less, typename P = ident,
-                    CONCEPT_REQUIRES_(BinarySearchable<I, V2, C, P>())>
+                    CONCEPT_REQUIRES_(!RandomAccessIterator<I>() && BinarySearchable<I, V2, C, P>())>
                 I operator()(I begin, iterator_difference_t<I> d, V2 const &val, C pred_ = C{},
                     P proj_ = P{}) const
                 {
@@ -51,6 +53,30 @@ namespace ranges
                     }
                     return begin;
                 }
+
+                // Branchless variant: the trip count depends only on d, and the comparison
+                // result selects the new begin with a conditional move instead of a jump.
+                // Both possible next probes are prefetched while this one is compared.
+                template<typename I, typename V2, typename C = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(RandomAccessIterator<I>() && BinarySearchable<I, V2, C, P>())>
+                I operator()(I begin, iterator_difference_t<I> d, V2 const &val, C pred_ = C{},
+                    P proj_ = P{}) const
+                {
+                    RANGES_ASSERT(0 <= d);
+                    auto &&pred = invokable(pred_);
+                    auto &&proj = invokable(proj_);
+                    if(0 == d)
+                        return begin;
+                    while(1 != d)
+                    {
+                        auto const half = d / 2;
+                        detail::prefetch(begin, half / 2);
+                        detail::prefetch(begin, half + half / 2);
+                        begin += pred(proj(*(begin + half)), val) ? half : 0;
+                        d -= half;
+                    }
+                    return begin + (pred(proj(*begin), val) ? 1 : 0);
+                }
             };
 
             constexpr lower_bound_n_fn lower_bound_n{};
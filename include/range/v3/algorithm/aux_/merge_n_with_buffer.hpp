@@ -28,13 +28,14 @@
 #ifndef RANGES_V3_ALGORITHM_AUX_MERGE_N_WITH_BUFFER_HPP
 #define RANGES_V3_ALGORITHM_AUX_MERGE_N_WITH_BUFFER_HPP
 
-#include <tuple>
+#include <memory>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/memory.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/invokable.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
-#include <range/v3/algorithm/copy_n.hpp>
-#include <range/v3/algorithm/aux_/merge_n.hpp>
 
 namespace ranges
 {
@@ -44,20 +45,49 @@ namespace ranges
         {
             struct merge_n_with_buffer_fn
             {
-                template<typename I, typename B, typename C = ordered_less, typename P = ident,
-                    typename VI = iterator_common_reference_t<I>,
-                    typename VB = iterator_common_reference_t<B>,
+                // Stably merges the adjacent sorted ranges [begin0, begin0 + n0) and
+                // [begin1, begin1 + n1) in place. buff points to raw storage for at
+                // least n0 objects. Only needs forward iterators: the first range is
+                // moved out of the way and the output never overtakes the second.
+                template<typename I, typename V, typename C = ordered_less, typename P = ident,
                     CONCEPT_REQUIRES_(
-                        Same<VI, VB>() &&
-                        IndirectlyCopyable<I, B>() &&
-                        Mergeable<B, I, I, C, P, P>()
+                        Same<iterator_value_t<I>, V>() &&
+                        Sortable<I, C, P>()
                     )>
                 I operator()(I begin0, iterator_difference_t<I> n0,
                              I begin1, iterator_difference_t<I> n1,
-                             B buff, C r = C{}, P p = P{}) const
+                             V *buff, C pred_ = C{}, P proj_ = P{}) const
                 {
-                    copy_n(begin0, n0, buff);
-                    return std::get<2>(merge_n(buff, n0, begin1, n1, begin0, r));
+                    auto &&pred = invokable(pred_);
+                    auto &&proj = invokable(proj_);
+                    using R = iterator_common_reference_t<I>;
+                    std::unique_ptr<V, detail::destroy_n<V>> h{buff, {}};
+                    auto p = ranges::make_counted_raw_storage_iterator(buff, h.get_deleter());
+                    I i = begin0;
+                    for(iterator_difference_t<I> k = 0; k != n0; ++k, ++i, ++p)
+                        *p = iter_move(i);
+                    V *b = buff, *const e = buff + n0;
+                    for(; b != e && 0 != n1; ++begin0)
+                    {
+                        if(pred(proj(R(*begin1)), proj(R(*b))))
+                        {
+                            *begin0 = iter_move(begin1);
+                            ++begin1;
+                            --n1;
+                        }
+                        else
+                        {
+                            *begin0 = std::move(*b);
+                            ++b;
+                        }
+                    }
+                    if(0 == n1)
+                    {
+                        for(; b != e; ++b, ++begin0)
+                            *begin0 = std::move(*b);
+                        return begin0;
+                    }
+                    return next(begin1, n1);
                 }
             };
 
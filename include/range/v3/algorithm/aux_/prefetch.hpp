@@ -0,0 +1,85 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_AUX_PREFETCH_HPP
+#define RANGES_V3_ALGORITHM_AUX_PREFETCH_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            template<typename V>
+            using is_char_type = meta::or_<Same<V, char>, Same<V, wchar_t>,
+                Same<V, char16_t>, Same<V, char32_t>>;
+
+            template<typename I, typename V, bool Char = is_char_type<V>::value>
+            struct is_string_iterator
+              : std::false_type
+            {};
+
+            template<typename I, typename V>
+            struct is_string_iterator<I, V, true>
+              : meta::or_<
+                    Same<I, typename std::basic_string<V>::iterator>,
+                    Same<I, typename std::basic_string<V>::const_iterator>>
+            {};
+
+            // Iterators known to point into an array: pointers, and the iterators of
+            // std::vector (but not std::vector<bool>) and std::basic_string.
+            template<typename I, typename V = iterator_value_t<I>,
+                bool Object = std::is_object<V>::value && !std::is_abstract<V>::value &&
+                    !std::is_same<V, bool>::value>
+            struct is_contiguous_iterator
+              : std::is_pointer<I>
+            {};
+
+            template<typename I, typename V>
+            struct is_contiguous_iterator<I, V, true>
+              : meta::or_<
+                    std::is_pointer<I>,
+                    Same<I, typename std::vector<V>::iterator>,
+                    Same<I, typename std::vector<V>::const_iterator>,
+                    is_string_iterator<I, V>>
+            {};
+
+            // Hint that *(i + n) will be read soon. Only the addresses of contiguous
+            // iterators are computed, from the address of *i; other iterators might run
+            // user code to get there, so for them this is a no-op.
+            template<typename I,
+                CONCEPT_REQUIRES_(!is_contiguous_iterator<I>())>
+            void prefetch(I const &, iterator_difference_t<I>)
+            {}
+
+            template<typename I,
+                CONCEPT_REQUIRES_(is_contiguous_iterator<I>())>
+            void prefetch(I const &i, iterator_difference_t<I> n)
+            {
+                RANGES_PREFETCH(std::addressof(*i) + n);
+            }
+        }
+        /// \endcond
+    }
+}
+
+#endif
@@ -28,10 +28,11 @@
 #ifndef RANGES_V3_ALGORITHM_AUX_SORT_N_WITH_BUFFER_HPP
 #define RANGES_V3_ALGORITHM_AUX_SORT_N_WITH_BUFFER_HPP
 
-#include <tuple>
+#include <functional>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/invokable.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/algorithm/aux_/merge_n_with_buffer.hpp>
@@ -44,22 +45,33 @@ namespace ranges
         {
             struct sort_n_with_buffer_fn
             {
-                template<typename I, typename B, typename C = ordered_less, typename P = ident,
-                    typename VI = iterator_common_reference_t<I>,
-                    typename VB = iterator_common_reference_t<B>,
-                    CONCEPT_REQUIRES_(
-                        Same<VI, VB>() &&
-                        IndirectlyCopyable<I, B>() &&
-                        Mergeable<B, I, I, C, P, P>()
-                    )>
-                I operator()(I begin, iterator_difference_t<I> n, B buff, C r = C{}, P p = P{}) const
+            private:
+                template<typename I, typename V, typename C, typename P>
+                static I impl(I begin, iterator_difference_t<I> n, V *buff, C &pred, P &proj)
                 {
                     auto half = n / 2;
                     if(0 == half)
                         return next(begin, n);
-                    I m = (*this)(begin, half, buff, r);
-                          (*this)(m, n - half, buff, r);
-                    return merge_n_with_buffer(begin, half, m, n - half, buff, r, p);
+                    I m = sort_n_with_buffer_fn::impl(begin, half, buff, pred, proj);
+                          sort_n_with_buffer_fn::impl(m, n - half, buff, pred, proj);
+                    return merge_n_with_buffer(begin, half, m, n - half, buff, std::ref(pred),
+                        std::ref(proj));
+                }
+
+            public:
+                // Stable merge sort of [begin, begin + n) needing only forward iterators.
+                // buff points to raw storage for at least n / 2 objects.
+                template<typename I, typename V, typename C = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(
+                        Same<iterator_value_t<I>, V>() &&
+                        Sortable<I, C, P>()
+                    )>
+                I operator()(I begin, iterator_difference_t<I> n, V *buff, C pred_ = C{},
+                    P proj_ = P{}) const
+                {
+                    auto &&pred = invokable(pred_);
+                    auto &&proj = invokable(proj_);
+                    return sort_n_with_buffer_fn::impl(std::move(begin), n, buff, pred, proj);
                 }
             };
 
@@ -0,0 +1,79 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_AUX_STABLE_SORT_N_HPP
+#define RANGES_V3_ALGORITHM_AUX_STABLE_SORT_N_HPP
+
+#include <memory>
+#include <functional>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/memory.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/invokable.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/algorithm/inplace_merge.hpp>
+#include <range/v3/algorithm/aux_/sort_n_with_buffer.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace aux
+        {
+            // Stable merge sort of [begin, begin + n) for forward iterators, such as
+            // those of std::forward_list or a filtered view. Uses a temporary buffer
+            // of n / 2 elements if it can get one and merges by rotations otherwise.
+            struct stable_sort_n_fn
+            {
+            private:
+                template<typename I, typename C, typename P>
+                static I sort_no_buffer(I begin, iterator_difference_t<I> n, C &pred, P &proj)
+                {
+                    auto half = n / 2;
+                    if(0 == half)
+                        return next(begin, n);
+                    I m = stable_sort_n_fn::sort_no_buffer(begin, half, pred, proj);
+                    I end = stable_sort_n_fn::sort_no_buffer(m, n - half, pred, proj);
+                    detail::forward_merge_no_buffer(begin, m, end, half, n - half,
+                        std::ref(pred), std::ref(proj));
+                    return end;
+                }
+
+            public:
+                template<typename I, typename C = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(Sortable<I, C, P>())>
+                I operator()(I begin, iterator_difference_t<I> n, C pred_ = C{},
+                    P proj_ = P{}) const
+                {
+                    auto &&pred = invokable(pred_);
+                    auto &&proj = invokable(proj_);
+                    using V = iterator_value_t<I>;
+                    if(n < 2)
+                        return next(begin, n);
+                    auto buf = std::get_temporary_buffer<V>(n / 2);
+                    std::unique_ptr<V, detail::return_temporary_buffer> h{buf.first};
+                    if(buf.second >= n / 2)
+                        return sort_n_with_buffer(std::move(begin), n, buf.first, std::ref(pred),
+                            std::ref(proj));
+                    return stable_sort_n_fn::sort_no_buffer(std::move(begin), n, pred, proj);
+                }
+            };
+
+            constexpr stable_sort_n_fn stable_sort_n{};
+
+        } // namespace aux
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -19,7 +19,9 @@
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/algorithm/aux_/prefetch.hpp>
 
 namespace ranges
 {
@@ -35,7 +37,7 @@ namespace ranges
                 ///
                 /// \pre `Rng` is a model of the `Iterable` concept
                 template<typename I, typename V2, typename C = ordered_less, typename P = ident,
-                    CONCEPT_REQUIRES_(BinarySearchable<I, V2, C, P>())>
+                    CONCEPT_REQUIRES_(!RandomAccessIterator<I>() && BinarySearchable<I, V2, C, P>())>
                 I operator()(I begin, iterator_difference_t<I> d, V2 const &val, C pred_ = C{},
                     P proj_ = P{}) const
                 {
@@ -56,6 +58,28 @@ namespace ranges
                     }
                     return begin;
                 }
+
+                // Branchless variant; see lower_bound_n.
+                template<typename I, typename V2, typename C = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(RandomAccessIterator<I>() && BinarySearchable<I, V2, C, P>())>
+                I operator()(I begin, iterator_difference_t<I> d, V2 const &val, C pred_ = C{},
+                    P proj_ = P{}) const
+                {
+                    RANGES_ASSERT(0 <= d);
+                    auto &&pred = invokable(pred_);
+                    auto &&proj = invokable(proj_);
+                    if(0 == d)
+                        return begin;
+                    while(1 != d)
+                    {
+                        auto const half = d / 2;
+                        detail::prefetch(begin, half / 2);
+                        detail::prefetch(begin, half + half / 2);
+                        begin += pred(val, proj(*(begin + half))) ? 0 : half;
+                        d -= half;
+                    }
+                    return begin + (pred(val, proj(*begin)) ? 0 : 1);
+                }
             };
 
             constexpr upper_bound_n_fn upper_bound_n {};
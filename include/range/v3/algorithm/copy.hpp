@@ -17,6 +17,7 @@
 #include <functional>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/range_access.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/utility/invokable.hpp>
@@ -33,6 +34,24 @@ namespace ranges
         /// @{
         struct copy_fn : aux::copy_fn
         {
+        private:
+            // A view can copy its elements faster than its iterators can by defining
+            // `template<typename O> O copy(O out)`, made available to `range_access`.
+            template<typename Rng, typename O,
+                CONCEPT_REQUIRES_(BoundedIterable<Rng>())>
+            static auto copy_(Rng &rng, O out, ident, int) ->
+                decltype((void)range_access::copy(rng, std::move(out)),
+                    std::pair<range_iterator_t<Rng>, O>{})
+            {
+                out = range_access::copy(rng, std::move(out));
+                return {end(rng), std::move(out)};
+            }
+            template<typename Rng, typename O, typename P>
+            std::pair<range_iterator_t<Rng>, O> copy_(Rng &rng, O out, P proj, long) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(out), std::move(proj));
+            }
+        public:
             using aux::copy_fn::operator();
 
             template<typename I, typename S, typename O, typename P = ident,
@@ -60,7 +79,7 @@ namespace ranges
             std::pair<I, O>
             operator()(Rng &rng, O out, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(out), std::move(proj));
+                return copy_fn::copy_(rng, std::move(out), std::move(proj), 0);
             }
         };
 
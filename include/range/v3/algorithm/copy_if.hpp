@@ -23,6 +23,7 @@
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/algorithm/aux_/compress_copy_if.hpp>
 
 namespace ranges
 {
@@ -39,7 +40,8 @@ namespace ranges
                     InputIterator<I>() && IteratorRange<I, S>() &&
                     WeaklyIncrementable<O>() &&
                     InvokablePredicate<F, X>() &&
-                    IndirectlyCopyable<I, O, P>()
+                    IndirectlyCopyable<I, O, P>() &&
+                    !aux::Compressible<I, S, P>()
                 )>
             std::pair<I, O>
             operator()(I begin, S end, O out, F pred_, P proj_ = P{}) const
@@ -57,6 +59,25 @@ namespace ranges
                 return {begin, out};
             }
 
+            // Branchless variant for contiguous ranges of numbers; see compress_copy_if.
+            template<typename I, typename O, typename F, typename P = ident,
+                typename V = iterator_common_reference_t<I>,
+                CONCEPT_REQUIRES_(
+                    InputIterator<I>() &&
+                    WeaklyIncrementable<O>() &&
+                    InvokablePredicate<F, V>() &&
+                    IndirectlyCopyable<I, O, P>() &&
+                    aux::Compressible<I, I, P>()
+                )>
+            std::pair<I, O>
+            operator()(I begin, I end, O out, F pred_, P = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto const n = end - begin;
+                out = aux::compress_copy_if(begin, n, std::move(out), pred, true);
+                return {begin + n, std::move(out)};
+            }
+
             template<typename Rng, typename O, typename F, typename P = ident,
                 typename I = range_iterator_t<Rng>,
                 typename V = iterator_common_reference_t<I>,
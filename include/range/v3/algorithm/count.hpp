@@ -15,6 +15,7 @@
 
 #include <utility>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/for_each_until.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
@@ -60,9 +61,17 @@ namespace ranges
                     EqualityComparable<X, V1>()
                 )>
             iterator_difference_t<I>
-            operator()(Rng &&rng, V1 const & val, P proj = P{}) const
+            operator()(Rng &&rng, V1 const & val, P proj_ = P{}) const
             {
-                return (*this)(begin(rng), end(rng), val, std::move(proj));
+                auto &&proj = invokable(proj_);
+                iterator_difference_t<I> n = 0;
+                for_each_until(rng, [&](range_reference_t<Rng> x)
+                {
+                    if(proj(static_cast<range_reference_t<Rng>>(x)) == val)
+                        ++n;
+                    return true;
+                });
+                return n;
             }
         };
 
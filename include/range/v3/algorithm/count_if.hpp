@@ -15,6 +15,7 @@
 
 #include <utility>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/for_each_until.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
@@ -61,9 +62,18 @@ namespace ranges
                     InvokablePredicate<R, X>()
                 )>
             iterator_difference_t<I>
-            operator()(Rng &&rng, R pred, P proj = P{}) const
+            operator()(Rng &&rng, R pred_, P proj_ = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                iterator_difference_t<I> n = 0;
+                for_each_until(rng, [&](range_reference_t<Rng> x)
+                {
+                    if(pred(proj(static_cast<range_reference_t<Rng>>(x))))
+                        ++n;
+                    return true;
+                });
+                return n;
             }
         };
 
@@ -0,0 +1,199 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_EYTZINGER_HPP
+#define RANGES_V3_ALGORITHM_EYTZINGER_HPP
+
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/distance.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/invokable.hpp>
+#include <range/v3/algorithm/aux_/prefetch.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        // The Eytzinger layout stores a sorted sequence as an implicit complete
+        // binary search tree in breadth-first order: the children of the element at
+        // index k live at 2k+1 and 2k+2. A search touches the first few levels
+        // over and over, so they stay in cache, and the sixteen great-great-
+        // grandchildren of a node are adjacent, so they can be prefetched together.
+
+        /// \cond
+        namespace detail
+        {
+            template<typename I, typename O>
+            I eytzinger_layout_impl(I begin, O out, iterator_difference_t<O> k,
+                iterator_difference_t<O> n)
+            {
+                if(k < n)
+                {
+                    begin = detail::eytzinger_layout_impl(std::move(begin), out, 2 * k + 1, n);
+                    out[k] = *begin;
+                    ++begin;
+                    begin = detail::eytzinger_layout_impl(std::move(begin), out, 2 * k + 2, n);
+                }
+                return begin;
+            }
+
+            // Returns the index of the first element for which go_right is false, in
+            // sorted order, or n if there is none.
+            template<typename I, typename F>
+            iterator_difference_t<I> eytzinger_search(I begin, iterator_difference_t<I> n,
+                F go_right)
+            {
+                // 1-based node numbers make the tree arithmetic branch-free.
+                iterator_difference_t<I> k = 1;
+                while(k <= n)
+                {
+                    if(16 * k <= n)
+                        detail::prefetch(begin, 16 * k - 1);
+                    k = 2 * k + (go_right(*(begin + (k - 1))) ? 1 : 0);
+                }
+                // Each right turn after the last left turn appended a 1 bit; strip
+                // them and the left turn to recover the node where we went left.
+                while(k & 1)
+                    k >>= 1;
+                k >>= 1;
+                return 0 == k ? n : k - 1;
+            }
+        }
+        /// \endcond
+
+        /// \addtogroup group-algorithms
+        /// @{
+        struct eytzinger_layout_fn
+        {
+            /// Copies the sorted range `[begin,end)` into the random-access output
+            /// sequence starting at `out`, in Eytzinger order. The input is read once,
+            /// front to back.
+            template<typename I, typename S, typename O,
+                CONCEPT_REQUIRES_(
+                    ForwardIterator<I>() && IteratorRange<I, S>() &&
+                    RandomAccessIterator<O>() &&
+                    IndirectlyCopyable<I, O>()
+                )>
+            std::pair<I, O>
+            operator()(I begin, S end, O out) const
+            {
+                auto const n = static_cast<iterator_difference_t<O>>(distance(begin, end));
+                begin = detail::eytzinger_layout_impl(std::move(begin), out, 0, n);
+                return {begin, out + n};
+            }
+
+            /// \overload
+            template<typename Rng, typename O,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(
+                    ForwardIterable<Rng &>() &&
+                    RandomAccessIterator<O>() &&
+                    IndirectlyCopyable<I, O>()
+                )>
+            std::pair<I, O>
+            operator()(Rng &rng, O out) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(out));
+            }
+        };
+
+        /// \sa `eytzinger_layout_fn`
+        /// \ingroup group-algorithms
+        constexpr eytzinger_layout_fn eytzinger_layout{};
+
+        struct eytzinger_lower_bound_fn
+        {
+            /// Searches a range arranged by `eytzinger_layout`. Returns an iterator to
+            /// the element that `lower_bound` would have found in the sorted range,
+            /// or `end` if there is no such element.
+            template<typename I, typename S, typename V, typename C = ordered_less,
+                typename P = ident,
+                CONCEPT_REQUIRES_(
+                    RandomAccessIterator<I>() && IteratorRange<I, S>() &&
+                    BinarySearchable<I, V, C, P>()
+                )>
+            I operator()(I begin, S end, V const &val, C pred_ = C{}, P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                auto const n = distance(begin, end);
+                using R = iterator_reference_t<I>;
+                return begin + detail::eytzinger_search(begin, n,
+                    [&](R r) { return pred(proj(static_cast<R>(r)), val); });
+            }
+
+            /// \overload
+            template<typename Rng, typename V, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(
+                    RandomAccessIterable<Rng &>() &&
+                    BinarySearchable<I, V, C, P>()
+                )>
+            I operator()(Rng &rng, V const &val, C pred = C{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), val, std::move(pred), std::move(proj));
+            }
+        };
+
+        /// \sa `eytzinger_lower_bound_fn`
+        /// \ingroup group-algorithms
+        constexpr eytzinger_lower_bound_fn eytzinger_lower_bound{};
+
+        struct eytzinger_upper_bound_fn
+        {
+            /// Like `eytzinger_lower_bound`, but finds the element that `upper_bound`
+            /// would have found.
+            template<typename I, typename S, typename V, typename C = ordered_less,
+                typename P = ident,
+                CONCEPT_REQUIRES_(
+                    RandomAccessIterator<I>() && IteratorRange<I, S>() &&
+                    BinarySearchable<I, V, C, P>()
+                )>
+            I operator()(I begin, S end, V const &val, C pred_ = C{}, P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                auto const n = distance(begin, end);
+                using R = iterator_reference_t<I>;
+                return begin + detail::eytzinger_search(begin, n,
+                    [&](R r) { return !pred(val, proj(static_cast<R>(r))); });
+            }
+
+            /// \overload
+            template<typename Rng, typename V, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(
+                    RandomAccessIterable<Rng &>() &&
+                    BinarySearchable<I, V, C, P>()
+                )>
+            I operator()(Rng &rng, V const &val, C pred = C{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), val, std::move(pred), std::move(proj));
+            }
+        };
+
+        /// \sa `eytzinger_upper_bound_fn`
+        /// \ingroup group-algorithms
+        constexpr eytzinger_upper_bound_fn eytzinger_upper_bound{};
+
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
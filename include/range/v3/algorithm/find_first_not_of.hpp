@@ -0,0 +1,77 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_FIND_FIRST_NOT_OF_HPP
+#define RANGES_V3_ALGORITHM_FIND_FIRST_NOT_OF_HPP
+
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/invokable.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/algorithm/find_first_of.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-algorithms
+        /// @{
+        struct find_first_not_of_fn
+        {
+            /// \return The first iterator `i` in `[begin0, end0)` such that
+            /// `pred(proj0(*i), proj1(*j))` is false for every `j` in `[begin1, end1)`,
+            /// or `end0` if there is none. The needles are gathered into a set first
+            /// when they can be, as in `find_first_of`.
+            template<typename I0, typename S0, typename I1, typename S1,
+                     typename R = equal_to, typename P0 = ident, typename P1 = ident,
+                     CONCEPT_REQUIRES_(IteratorRange<I0, S0>() && IteratorRange<I1, S1>() &&
+                        ForwardIterator<I1>() && AsymmetricallyComparable<I0, I1, R, P0, P1>())>
+            I0 operator()(I0 begin0, S0 end0, I1 begin1, S1 end1, R pred_ = R{}, P0 proj0_ = P0{},
+                P1 proj1_ = P1{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj0 = invokable(proj0_);
+                auto &&proj1 = invokable(proj1_);
+                return detail::find_set_member<false>(std::move(begin0), std::move(end0),
+                    std::move(begin1), std::move(end1), pred, proj0, proj1,
+                    detail::set_search_t<I0, I1, R, P0, P1>{});
+            }
+
+            /// \overload
+            template<typename Rng0, typename Rng1, typename R = equal_to,
+                     typename P0 = ident, typename P1 = ident,
+                     typename I0 = range_iterator_t<Rng0>,
+                     typename I1 = range_iterator_t<Rng1>,
+                     CONCEPT_REQUIRES_(Iterable<Rng0>() && Iterable<Rng1>() &&
+                        ForwardIterator<I1>() && AsymmetricallyComparable<I0, I1, R, P0, P1>())>
+            I0 operator()(Rng0 & rng0, Rng1 && rng1, R pred = R{}, P0 proj0 = P0{},
+                P1 proj1 = P1{}) const
+            {
+                return (*this)(begin(rng0), end(rng0), begin(rng1), end(rng1), std::move(pred),
+                    std::move(proj0), std::move(proj1));
+            }
+        };
+
+        /// \sa `find_first_not_of_fn`
+        /// \ingroup group-algorithms
+        constexpr with_braced_init_args<find_first_not_of_fn> find_first_not_of {};
+
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
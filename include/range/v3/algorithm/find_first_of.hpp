@@ -4,29 +4,146 @@
 //  Copyright Eric Niebler 2014
 //
 //  Use, modification and distribution is subject to the
-//  Boost Software License, Version 0.0. (See accompanying
-//  file LICENSE_0_0.txt or copy at
-//  http://www.boost.org/LICENSE_0_0.txt)
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
 //
 // Project home: https://github.com/ericniebler/range-v3
 //
 #ifndef RANGES_V3_ALGORITHM_FIND_FIRST_OF_HPP
 #define RANGES_V3_ALGORITHM_FIND_FIRST_OF_HPP
 
+#include <cstdint>
 #include <utility>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/utility/meta.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/invokable.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/flat_hash_table.hpp>
 
 namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            // How find_first_of and find_first_not_of test an element against the
+            // set of needles.
+            struct linear_set_search {};  // compare with each needle in turn
+            struct byte_set_search {};    // look it up in a 256-bit table
+            struct hash_set_search {};    // look it up in a hash set, for many needles
+
+            // The needles can be put in a set only if the elements are compared with
+            // == as they are, and have the same value type.
+            template<typename I0, typename I1, typename R, typename P0, typename P1,
+                typename V = iterator_value_t<I0>>
+            using set_search_t =
+                meta::if_c<
+                    !(std::is_same<R, equal_to>::value && std::is_same<P0, ident>::value &&
+                        std::is_same<P1, ident>::value &&
+                        std::is_same<V, iterator_value_t<I1>>::value &&
+                        Convertible<iterator_reference_t<I0>, V>() &&
+                        Convertible<iterator_reference_t<I1>, V>()),
+                    linear_set_search,
+                    meta::if_c<
+                        std::is_integral<V>::value && sizeof(V) == 1 &&
+                            !std::is_same<V, bool>::value,
+                        byte_set_search,
+                        meta::if_c<
+                            is_std_hashable<V>::value,
+                            hash_set_search,
+                            linear_set_search>>>;
+
+            // A set of bytes, one bit each.
+            struct byte_set
+            {
+            private:
+                std::uint64_t bits_[4] = {0, 0, 0, 0};
+            public:
+                void insert(unsigned char ch)
+                {
+                    bits_[ch >> 6] |= std::uint64_t(1) << (ch & 63);
+                }
+                bool contains(unsigned char ch) const
+                {
+                    return (bits_[ch >> 6] >> (ch & 63)) & 1;
+                }
+            };
+
+            // Below this many needles, comparing with each is faster than hashing.
+            constexpr std::size_t hash_set_search_min()
+            {
+                return 16;
+            }
+
+            // The first element of [begin0, end0) that is (if Member) or is not (if
+            // !Member) equal to one of [begin1, end1).
+            template<bool Member, typename I0, typename S0, typename I1, typename S1,
+                typename R, typename P0, typename P1>
+            I0 find_set_member(I0 begin0, S0 end0, I1 begin1, S1 end1, R &pred, P0 &proj0,
+                P1 &proj1, linear_set_search)
+            {
+                for(; begin0 != end0; ++begin0)
+                {
+                    auto &&x = proj0(*begin0);
+                    auto tmp = begin1;
+                    for(; tmp != end1; ++tmp)
+                        if(pred(x, proj1(*tmp)))
+                            break;
+                    if((tmp != end1) == Member)
+                        return begin0;
+                }
+                return begin0;
+            }
+
+            template<bool Member, typename I0, typename S0, typename I1, typename S1,
+                typename R, typename P0, typename P1>
+            I0 find_set_member(I0 begin0, S0 end0, I1 begin1, S1 end1, R &, P0 &, P1 &,
+                byte_set_search)
+            {
+                byte_set set;
+                for(; begin1 != end1; ++begin1)
+                    set.insert(static_cast<unsigned char>(*begin1));
+                for(; begin0 != end0; ++begin0)
+                    if(set.contains(static_cast<unsigned char>(*begin0)) == Member)
+                        break;
+                return begin0;
+            }
+
+            template<bool Member, typename I0, typename S0, typename I1, typename S1,
+                typename R, typename P0, typename P1>
+            I0 find_set_member(I0 begin0, S0 end0, I1 begin1, S1 end1, R &pred, P0 &proj0,
+                P1 &proj1, hash_set_search)
+            {
+                using V = iterator_value_t<I0>;
+                std::size_t n = 0;
+                for(auto tmp = begin1; tmp != end1 && n < hash_set_search_min(); ++tmp)
+                    ++n;
+                if(n < hash_set_search_min())
+                    return detail::find_set_member<Member>(std::move(begin0), std::move(end0),
+                        std::move(begin1), std::move(end1), pred, proj0, proj1,
+                        linear_set_search{});
+                flat_hash_table<V> set;
+                for(; begin1 != end1; ++begin1)
+                    set.emplace(V(*begin1));
+                for(; begin0 != end0; ++begin0)
+                {
+                    V const &x = *begin0;
+                    if((set.find(x) != set.size()) == Member)
+                        break;
+                }
+                return begin0;
+            }
+        }
+        /// \endcond
+
         /// \addtogroup group-algorithms
         /// @{
         struct find_first_of_fn
@@ -36,6 +153,12 @@ namespace ranges
             // losing information. E.g., if begin0 == end0, we can return begin0 immediately.
             // If we returned pair<I0,I1>, we would need to do an O(N) scan to find the
             // end position.
+            //
+            // When the elements are compared with == and have the same value type, the
+            // needles are gathered into a set first: a 256-bit table for byte-sized
+            // integers, or a hash set for many needles of a type that std::hash
+            // supports. Then each element of [begin0, end0) costs one lookup rather
+            // than a comparison with each needle.
             template<typename I0, typename S0, typename I1, typename S1,
                      typename R = equal_to, typename P0 = ident, typename P1 = ident,
                      CONCEPT_REQUIRES_(IteratorRange<I0, S0>() && IteratorRange<I1, S1>() &&
@@ -46,11 +169,9 @@ namespace ranges
                 auto &&pred = invokable(pred_);
                 auto &&proj0 = invokable(proj0_);
                 auto &&proj1 = invokable(proj1_);
-                for(; begin0 != end0; ++begin0)
-                    for(auto tmp = begin1; tmp != end1; ++tmp)
-                        if(pred(proj0(*begin0), proj1(*tmp)))
-                            return begin0;
-                return begin0;
+                return detail::find_set_member<true>(std::move(begin0), std::move(end0),
+                    std::move(begin1), std::move(end1), pred, proj0, proj1,
+                    detail::set_search_t<I0, I1, R, P0, P1>{});
             }
 
             template<typename Rng0, typename Rng1, typename R = equal_to,
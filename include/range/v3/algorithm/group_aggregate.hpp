@@ -0,0 +1,124 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_GROUP_AGGREGATE_HPP
+#define RANGES_V3_ALGORITHM_GROUP_AGGREGATE_HPP
+
+#include <vector>
+#include <utility>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/invokable.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/flat_hash_table.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-algorithms
+        /// @{
+        struct group_aggregate_fn
+        {
+        private:
+            struct first_fn
+            {
+                template<typename T, typename U>
+                T const &operator()(std::pair<T, U> const &p) const
+                {
+                    return p.first;
+                }
+            };
+
+            static constexpr std::size_t max_presize()
+            {
+                return 1u << 16;
+            }
+
+            template<typename I, typename S>
+            static void reserve(I const &, S const &, std::size_t &, std::false_type)
+            {}
+            template<typename I, typename S>
+            static void reserve(I const &begin, S const &end, std::size_t &n, std::true_type)
+            {
+                n = static_cast<std::size_t>(end - begin);
+            }
+
+        public:
+            /// Groups the elements of `[begin,end)` by `key_proj(*i)`, which need not be
+            /// sorted, and folds each group into an accumulator that starts as `init`:
+            /// `acc = op(std::move(acc), value_proj(*i))`. Returns the (key, accumulator)
+            /// pairs, in the order in which the keys were first seen.
+            ///
+            /// The groups are found with an open-addressing hash table on the keys, so the
+            /// key type must be hashable with `std::hash`. When the size of the input is
+            /// known up front, the table is sized for it (up to 64K groups), so small
+            /// inputs never rehash.
+            template<typename I, typename S, typename PK, typename T, typename Op = plus,
+                typename PV = ident,
+                typename K = meta::eval<std::decay<
+                    concepts::Invokable::result_t<PK, iterator_reference_t<I>>>>,
+                typename V = concepts::Invokable::result_t<PV, iterator_reference_t<I>>,
+                CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() &&
+                    Invokable<PK, iterator_reference_t<I>>() &&
+                    Invokable<PV, iterator_reference_t<I>>() &&
+                    EqualityComparable<K>() &&
+                    Assignable<T &, concepts::Invokable::result_t<Op, T, V>>())>
+            std::vector<std::pair<K, T>>
+            operator()(I begin, S end, PK key_proj_, T init, Op op_ = Op{},
+                PV value_proj_ = PV{}) const
+            {
+                auto &&key_proj = invokable(key_proj_);
+                auto &&value_proj = invokable(value_proj_);
+                auto &&op = invokable(op_);
+                detail::flat_hash_table<std::pair<K, T>, first_fn> groups;
+                // Any element might start a new group, but sizing the table for all of
+                // them would spread a few groups over far more memory than they need.
+                std::size_t n = 0;
+                group_aggregate_fn::reserve(begin, end, n, SizedIteratorRange<I, S>());
+                groups.reserve(n < max_presize() ? n : max_presize());
+                for(; begin != end; ++begin)
+                {
+                    auto &&ref = *begin;
+                    T &acc = groups.entries()[groups.emplace(key_proj(ref), init).first].second;
+                    acc = op(std::move(acc), value_proj(ref));
+                }
+                return std::move(groups.entries());
+            }
+
+            /// \overload
+            template<typename Rng, typename PK, typename T, typename Op = plus,
+                typename PV = ident, typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(InputIterable<Rng &>())>
+            auto operator()(Rng &rng, PK key_proj, T init, Op op = Op{}, PV value_proj = PV{}) const ->
+                decltype(std::declval<group_aggregate_fn const &>()(begin(rng), end(rng),
+                    std::move(key_proj), std::move(init), std::move(op), std::move(value_proj)))
+            {
+                return (*this)(begin(rng), end(rng), std::move(key_proj), std::move(init),
+                    std::move(op), std::move(value_proj));
+            }
+        };
+
+        /// \sa `group_aggregate_fn`
+        /// \ingroup group-algorithms
+        constexpr group_aggregate_fn group_aggregate{};
+
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -21,6 +21,7 @@
 #ifndef RANGES_V3_ALGORITHM_HEAP_ALGORITHM_HPP
 #define RANGES_V3_ALGORITHM_HEAP_ALGORITHM_HPP
 
+#include <cstddef>
 #include <functional>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/distance.hpp>
@@ -32,6 +33,7 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/invokable.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/algorithm/aux_/prefetch.hpp>
 
 namespace ranges
 {
@@ -46,63 +48,72 @@ namespace ranges
             Invokable<P, V>,
             InvokableRelation<C, X>>;
 
+        // In a d-ary heap the children of the element at index i are at d*i+1 through
+        // d*i+d. The algorithms below are templated on the arity d; the familiar
+        // binary heap algorithms, `push_heap` and friends, are the d == 2 case. Wider
+        // heaps are shallower and keep siblings on the same cache line, which makes
+        // sifts through large heaps cheaper at the cost of more comparisons per level.
+
         /// \cond
         namespace detail
         {
+            template<std::size_t Arity>
             struct is_heap_until_n_fn
             {
+                static_assert(Arity >= 2, "A heap node must have at least two children");
+
                 template<typename I, typename C = ordered_less, typename P = ident,
                     CONCEPT_REQUIRES_(IsHeapable<I, C, P>())>
                 I operator()(I const begin_, iterator_difference_t<I> const n_, C pred_ = C{}, P proj_ = P{}) const
                 {
                     RANGES_ASSERT(0 <= n_);
+                    using D = iterator_difference_t<I>;
                     auto &&pred = invokable(pred_);
                     auto &&proj = invokable(proj_);
-                    iterator_difference_t<I> p = 0, c = 1;
-                    I pp = begin_;
-                    while(c < n_)
+                    D c = 1;
+                    for(I pp = begin_; c < n_; ++pp)
                     {
-                        I cp = begin_ + c;
-                        if(pred(proj(*pp), proj(*cp)))
-                            return cp;
-                        ++c;
-                        ++cp;
-                        if(c == n_ || pred(proj(*pp), proj(*cp)))
-                            return cp;
-                        ++p;
-                        ++pp;
-                        c = 2 * p + 1;
+                        D const last = n_ - c < D(Arity) ? n_ : c + D(Arity);
+                        for(; c < last; ++c)
+                        {
+                            I cp = begin_ + c;
+                            if(pred(proj(*pp), proj(*cp)))
+                                return cp;
+                        }
                     }
                     return begin_ + n_;
                 }
             };
 
-            constexpr is_heap_until_n_fn is_heap_until_n {};
+            constexpr is_heap_until_n_fn<2> is_heap_until_n {};
 
+            template<std::size_t Arity>
             struct is_heap_n_fn
             {
                 template<typename I, typename C = ordered_less, typename P = ident,
                     CONCEPT_REQUIRES_(IsHeapable<I, C, P>())>
                 bool operator()(I begin, iterator_difference_t<I> n, C pred = C{}, P proj = P{}) const
                 {
-                    return is_heap_until_n(begin, n, std::move(pred), std::move(proj)) == begin + n;
+                    return is_heap_until_n_fn<Arity>{}(begin, n, std::move(pred), std::move(proj)) ==
+                        begin + n;
                 }
             };
 
-            constexpr is_heap_n_fn is_heap_n {};
+            constexpr is_heap_n_fn<2> is_heap_n {};
         }
         /// \endcond
 
         /// \addtogroup group-algorithms
         /// @{
-        struct is_heap_until_fn
+        template<std::size_t Arity>
+        struct is_dary_heap_until_fn
         {
             template<typename I, typename S, typename C = ordered_less, typename P = ident,
                 CONCEPT_REQUIRES_(IsHeapable<I, C, P>() && IteratorRange<I, S>())>
             I operator()(I begin, S end, C pred = C{}, P proj = P{}) const
             {
-                return detail::is_heap_until_n(std::move(begin), distance(begin, end), std::move(pred),
-                    std::move(proj));
+                return detail::is_heap_until_n_fn<Arity>{}(std::move(begin), distance(begin, end),
+                    std::move(pred), std::move(proj));
             }
 
             template<typename Rng, typename C = ordered_less, typename P = ident,
@@ -110,22 +121,26 @@ namespace ranges
                 CONCEPT_REQUIRES_(IsHeapable<I, C, P>() && Iterable<Rng &>())>
             I operator()(Rng &rng, C pred = C{}, P proj = P{}) const
             {
-                return detail::is_heap_until_n(begin(rng), distance(rng), std::move(pred), std::move(proj));
+                return detail::is_heap_until_n_fn<Arity>{}(begin(rng), distance(rng),
+                    std::move(pred), std::move(proj));
             }
         };
 
+        using is_heap_until_fn = is_dary_heap_until_fn<2>;
+
         /// \sa `is_heap_until_fn`
         /// \ingroup group-algorithms
         constexpr is_heap_until_fn is_heap_until {};
 
-        struct is_heap_fn
+        template<std::size_t Arity>
+        struct is_dary_heap_fn
         {
             template<typename I, typename S, typename C = ordered_less, typename P = ident,
                 CONCEPT_REQUIRES_(IsHeapable<I, C, P>() && IteratorRange<I, S>())>
             bool operator()(I begin, S end, C pred = C{}, P proj = P{}) const
             {
-                return detail::is_heap_n(std::move(begin), distance(begin, end), std::move(pred),
-                    std::move(proj));
+                return detail::is_heap_n_fn<Arity>{}(std::move(begin), distance(begin, end),
+                    std::move(pred), std::move(proj));
             }
 
             template<typename Rng, typename C = ordered_less, typename P = ident,
@@ -133,10 +148,13 @@ namespace ranges
                 CONCEPT_REQUIRES_(IsHeapable<I, C, P>() && Iterable<Rng>())>
             bool operator()(Rng &&rng, C pred = C{}, P proj = P{}) const
             {
-                return detail::is_heap_n(begin(rng), distance(rng), std::move(pred), std::move(proj));
+                return detail::is_heap_n_fn<Arity>{}(begin(rng), distance(rng), std::move(pred),
+                    std::move(proj));
             }
         };
 
+        using is_heap_fn = is_dary_heap_fn<2>;
+
         /// \sa `is_heap_fn`
         /// \ingroup group-algorithms
         constexpr with_braced_init_args<is_heap_fn> is_heap {};
@@ -145,18 +163,33 @@ namespace ranges
         /// \cond
         namespace detail
         {
+            // Index of the greatest of the (at most Arity) children starting at child.
+            template<std::size_t Arity, typename I, typename C, typename P>
+            iterator_difference_t<I> heap_max_child(I begin, iterator_difference_t<I> len,
+                iterator_difference_t<I> child, C &pred, P &proj)
+            {
+                using D = iterator_difference_t<I>;
+                D const last = len - child < D(Arity) ? len : child + D(Arity);
+                for(D c = child + 1; c < last; ++c)
+                    if(pred(proj(*(begin + child)), proj(*(begin + c))))
+                        child = c;
+                return child;
+            }
+
+            template<std::size_t Arity>
             struct sift_up_n_fn
             {
                 template<typename I, typename C = ordered_less, typename P = ident>
                 void operator()(I begin, iterator_difference_t<I> len, C pred_ = C{}, P proj_ = P{}) const
                 {
                     using R = iterator_common_reference_t<I>;
+                    using D = iterator_difference_t<I>;
                     if(len > 1)
                     {
                         auto &&pred = invokable(pred_);
                         auto &&proj = invokable(proj_);
                         I end = begin + len;
-                        len = (len - 2) / 2;
+                        len = (len - 2) / D(Arity);
                         I i = begin + len;
                         if(pred(proj(*i), proj(*--end)))
                         {
@@ -167,7 +200,7 @@ namespace ranges
                                 end = i;
                                 if(len == 0)
                                     break;
-                                len = (len - 1) / 2;
+                                len = (len - 1) / D(Arity);
                                 i = begin + len;
                             } while(pred(proj(R(*i)), proj(R(v))));
                             *end = std::move(v);
@@ -176,33 +209,28 @@ namespace ranges
                 }
             };
 
-            constexpr sift_up_n_fn sift_up_n{};
+            constexpr sift_up_n_fn<2> sift_up_n{};
 
+            template<std::size_t Arity>
             struct sift_down_n_fn
             {
                 template<typename I, typename C = ordered_less, typename P = ident>
                 void operator()(I begin, iterator_difference_t<I> len, I start, C pred_ = C {}, P proj_ = P{}) const
                 {
                     using R = iterator_common_reference_t<I>;
-                    // left-child of start is at 2 * start + 1
-                    // right-child of start is at 2 * start + 2
-                    auto child = start - begin;
+                    using D = iterator_difference_t<I>;
+                    // the children of start are at Arity * start + 1 through
+                    // Arity * start + Arity
+                    D child = start - begin;
 
-                    if(len < 2 || (len - 2) / 2 < child)
+                    if(len < 2 || (len - 2) / D(Arity) < child)
                         return;
 
-                    child = 2 * child + 1;
-                    I child_i = begin + child;
-
                     auto &&pred = invokable(pred_);
                     auto &&proj = invokable(proj_);
 
-                    if((child + 1) < len && pred(proj(*child_i), proj(*(child_i + 1))))
-                    {
-                        // right-child exists and is greater than left-child
-                        ++child_i;
-                        ++child;
-                    }
+                    child = detail::heap_max_child<Arity>(begin, len, D(Arity) * child + 1, pred, proj);
+                    I child_i = begin + child;
 
                     // check if we are in heap-order
                     if(pred(proj(*child_i), proj(*start)))
@@ -216,40 +244,34 @@ namespace ranges
                         *start = iter_move(child_i);
                         start = child_i;
 
-                        if((len - 2) / 2 < child)
+                        if((len - 2) / D(Arity) < child)
                             break;
 
                         // recompute the child based off of the updated parent
-                        child = 2 * child + 1;
+                        child = detail::heap_max_child<Arity>(begin, len, D(Arity) * child + 1, pred, proj);
                         child_i = begin + child;
 
-                        if((child + 1) < len && pred(proj(*child_i), proj(*(child_i + 1))))
-                        {
-                            // right-child exists and is greater than left-child
-                            ++child_i;
-                            ++child;
-                        }
-
                         // check if we are in heap-order
                     } while (!pred(proj(R(*child_i)), proj(R(top))));
                     *start = std::move(top);
                 }
             };
 
-            constexpr sift_down_n_fn sift_down_n{};
+            constexpr sift_down_n_fn<2> sift_down_n{};
         }
         /// \endcond
 
         /// \addtogroup group-algorithms
         /// @{
-        struct push_heap_fn
+        template<std::size_t Arity>
+        struct push_dary_heap_fn
         {
             template<typename I, typename S, typename C = ordered_less, typename P = ident,
                 CONCEPT_REQUIRES_(RandomAccessIterator<I>() && IteratorRange<I, S>() && Sortable<I, C, P>())>
             I operator()(I begin, S end, C pred = C{}, P proj = P{}) const
             {
                 auto n = distance(begin, end);
-                detail::sift_up_n(begin, n, std::move(pred), std::move(proj));
+                detail::sift_up_n_fn<Arity>{}(begin, n, std::move(pred), std::move(proj));
                 return begin + n;
             }
 
@@ -260,11 +282,13 @@ namespace ranges
             {
                 I begin = ranges::begin(rng);
                 auto n = distance(rng);
-                detail::sift_up_n(begin, n, std::move(pred), std::move(proj));
+                detail::sift_up_n_fn<Arity>{}(begin, n, std::move(pred), std::move(proj));
                 return begin + n;
             }
         };
 
+        using push_heap_fn = push_dary_heap_fn<2>;
+
         /// \sa `push_heap_fn`
         /// \ingroup group-algorithms
         constexpr push_heap_fn push_heap {};
@@ -273,35 +297,66 @@ namespace ranges
         /// \cond
         namespace detail
         {
+            template<std::size_t Arity>
             struct pop_heap_n_fn
             {
+                // Bottom-up ("Floyd") pop: walk the hole left by the top down to a leaf,
+                // promoting the greatest child at each level, then put the last element
+                // in the hole and sift it back up. The last element nearly always
+                // belongs near the bottom, so this saves the comparison against it on
+                // every level of the way down.
                 template<typename I, typename C = ordered_less, typename P = ident,
                     CONCEPT_REQUIRES_(RandomAccessIterator<I>() && Sortable<I, C, P>())>
-                void operator()(I begin, iterator_difference_t<I> len, C pred = C{},
-                    P proj = P{}) const
+                void operator()(I begin, iterator_difference_t<I> len, C pred_ = C{},
+                    P proj_ = P{}) const
                 {
+                    using D = iterator_difference_t<I>;
                     if(len > 1)
                     {
-                        ranges::iter_swap(begin, begin + (len-1));
-                        detail::sift_down_n(begin, len-1, begin, std::move(pred), std::move(proj));
+                        auto &&pred = invokable(pred_);
+                        auto &&proj = invokable(proj_);
+                        I const last = begin + (len - 1);
+                        iterator_value_t<I> top = iter_move(begin);
+                        D hole = 0;
+                        I hole_i = begin;
+                        while((len - 2) / D(Arity) >= hole)
+                        {
+                            D child = detail::heap_max_child<Arity>(begin, len,
+                                D(Arity) * hole + 1, pred, proj);
+                            I child_i = begin + child;
+                            if((len - 2) / D(Arity) >= child)
+                                detail::prefetch(begin, D(Arity) * child + 1);
+                            *hole_i = iter_move(child_i);
+                            hole = child;
+                            hole_i = child_i;
+                        }
+                        if(hole_i == last)
+                            *hole_i = std::move(top);
+                        else
+                        {
+                            *hole_i = iter_move(last);
+                            *last = std::move(top);
+                            sift_up_n_fn<Arity>{}(begin, hole + 1, std::ref(pred), std::ref(proj));
+                        }
                     }
                 }
             };
 
-            constexpr pop_heap_n_fn pop_heap_n{};
+            constexpr pop_heap_n_fn<2> pop_heap_n{};
         }
         /// \endcond
 
         /// \addtogroup group-algorithms
         /// @{
-        struct pop_heap_fn
+        template<std::size_t Arity>
+        struct pop_dary_heap_fn
         {
             template<typename I, typename S, typename C = ordered_less, typename P = ident,
                 CONCEPT_REQUIRES_(RandomAccessIterator<I>() && IteratorRange<I, S>() && Sortable<I, C, P>())>
             I operator()(I begin, S end, C pred = C{}, P proj = P{}) const
             {
                 auto n = distance(begin, end);
-                detail::pop_heap_n(begin, n, std::move(pred), std::move(proj));
+                detail::pop_heap_n_fn<Arity>{}(begin, n, std::move(pred), std::move(proj));
                 return begin + n;
             }
 
@@ -312,16 +367,19 @@ namespace ranges
             {
                 I begin = ranges::begin(rng);
                 auto n = distance(rng);
-                detail::pop_heap_n(begin, n, std::move(pred), std::move(proj));
+                detail::pop_heap_n_fn<Arity>{}(begin, n, std::move(pred), std::move(proj));
                 return begin + n;
             }
         };
 
+        using pop_heap_fn = pop_dary_heap_fn<2>;
+
         /// \sa `pop_heap_fn`
         /// \ingroup group-algorithms
         constexpr pop_heap_fn pop_heap {};
 
-        struct make_heap_fn
+        template<std::size_t Arity>
+        struct make_dary_heap_fn
         {
             template<typename I, typename S, typename C = ordered_less, typename P = ident,
                 CONCEPT_REQUIRES_(RandomAccessIterator<I>() && IteratorRange<I, S>() && Sortable<I, C, P>())>
@@ -332,33 +390,29 @@ namespace ranges
                 iterator_difference_t<I> const n = distance(begin, end);
                 if(n > 1)
                     // start from the first parent, there is no need to consider children
-                    for(auto start = (n - 2) / 2; start >= 0; --start)
-                        detail::sift_down_n(begin, n, begin + start, std::ref(pred), std::ref(proj));
+                    for(auto start = (n - 2) / iterator_difference_t<I>(Arity); start >= 0; --start)
+                        detail::sift_down_n_fn<Arity>{}(begin, n, begin + start, std::ref(pred),
+                            std::ref(proj));
                 return begin + n;
             }
 
             template<typename Rng, typename C = ordered_less, typename P = ident,
                 typename I = range_iterator_t<Rng>,
                 CONCEPT_REQUIRES_(RandomAccessIterable<Rng &>() && Sortable<I, C, P>())>
-            I operator()(Rng & rng, C pred_ = C{}, P proj_ = P{}) const
+            I operator()(Rng & rng, C pred = C{}, P proj = P{}) const
             {
-                auto &&pred = invokable(pred_);
-                auto &&proj = invokable(proj_);
-                I begin = ranges::begin(rng);
-                iterator_difference_t<I> const n = distance(rng);
-                if(n > 1)
-                    // start from the first parent, there is no need to consider children
-                    for(auto start = (n - 2) / 2; start >= 0; --start)
-                        detail::sift_down_n(begin, n, begin + start, std::ref(pred), std::ref(proj));
-                return begin + n;
+                return (*this)(ranges::begin(rng), ranges::end(rng), std::move(pred), std::move(proj));
             }
         };
 
+        using make_heap_fn = make_dary_heap_fn<2>;
+
         /// \sa `make_heap_fn`
         /// \ingroup group-algorithms
         constexpr make_heap_fn make_heap {};
 
-        struct sort_heap_fn
+        template<std::size_t Arity>
+        struct sort_dary_heap_fn
         {
             template<typename I, typename S, typename C = ordered_less, typename P = ident,
                 CONCEPT_REQUIRES_(RandomAccessIterator<I>() && IteratorRange<I, S>() && Sortable<I, C, P>())>
@@ -368,25 +422,21 @@ namespace ranges
                 auto &&proj = invokable(proj_);
                 iterator_difference_t<I> const n = distance(begin, end);
                 for(auto i = n; i > 1; --i)
-                    detail::pop_heap_n(begin, i, std::ref(pred), std::ref(proj));
+                    detail::pop_heap_n_fn<Arity>{}(begin, i, std::ref(pred), std::ref(proj));
                 return begin + n;
             }
 
             template<typename Rng, typename C = ordered_less, typename P = ident,
                 typename I = range_iterator_t<Rng>,
                 CONCEPT_REQUIRES_(RandomAccessIterable<Rng &>() && Sortable<I, C, P>())>
-            I operator()(Rng & rng, C pred_ = C{}, P proj_ = P{}) const
+            I operator()(Rng & rng, C pred = C{}, P proj = P{}) const
             {
-                auto &&pred = invokable(pred_);
-                auto &&proj = invokable(proj_);
-                I begin = ranges::begin(rng);
-                iterator_difference_t<I> const n = distance(rng);
-                for(auto i = n; i > 1; --i)
-                    detail::pop_heap_n(begin, i, std::ref(pred), std::ref(proj));
-                return begin + n;
+                return (*this)(ranges::begin(rng), ranges::end(rng), std::move(pred), std::move(proj));
             }
         };
 
+        using sort_heap_fn = sort_dary_heap_fn<2>;
+
         /// \sa `sort_heap_fn`
         /// \ingroup group-algorithms
         constexpr sort_heap_fn sort_heap {};
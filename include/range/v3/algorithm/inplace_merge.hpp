@@ -43,6 +43,7 @@
 #include <range/v3/algorithm/move.hpp>
 #include <range/v3/algorithm/merge_move.hpp>
 #include <range/v3/algorithm/rotate.hpp>
+#include <range/v3/algorithm/aux_/merge_n_with_buffer.hpp>
 
 namespace ranges
 {
@@ -185,6 +186,63 @@ namespace ranges
             };
 
             constexpr inplace_merge_no_buffer_fn inplace_merge_no_buffer {};
+
+            // Merges without a buffer by repeatedly splitting one run at its middle,
+            // finding the matching cut in the other, and rotating the two inner pieces
+            // into place. Only needs forward iterators.
+            struct forward_merge_no_buffer_fn
+            {
+            private:
+                template<typename I, typename C, typename P>
+                static void impl(I begin, I middle, I end, iterator_difference_t<I> len1,
+                    iterator_difference_t<I> len2, C &pred, P &proj)
+                {
+                    using D = iterator_difference_t<I>;
+                    if(len1 == 0 || len2 == 0)
+                        return;
+                    if(len1 + len2 == 2)
+                    {
+                        if(pred(proj(*middle), proj(*begin)))
+                            ranges::iter_swap(begin, middle);
+                        return;
+                    }
+                    I cut1, cut2;
+                    D len11, len22;
+                    if(len1 > len2)
+                    {
+                        len11 = len1 / 2;
+                        cut1 = next(begin, len11);
+                        cut2 = lower_bound(middle, end, proj(*cut1), std::ref(pred), std::ref(proj));
+                        len22 = distance(middle, cut2);
+                    }
+                    else
+                    {
+                        len22 = len2 / 2;
+                        cut2 = next(middle, len22);
+                        cut1 = upper_bound(begin, middle, proj(*cut2), std::ref(pred), std::ref(proj));
+                        len11 = distance(begin, cut1);
+                    }
+                    I new_middle = rotate(cut1, middle, cut2).begin();
+                    forward_merge_no_buffer_fn::impl(begin, cut1, new_middle, len11, len22, pred,
+                        proj);
+                    forward_merge_no_buffer_fn::impl(new_middle, cut2, end, len1 - len11,
+                        len2 - len22, pred, proj);
+                }
+
+            public:
+                template<typename I, typename C = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(Sortable<I, C, P>())>
+                void operator()(I begin, I middle, I end, iterator_difference_t<I> len1,
+                    iterator_difference_t<I> len2, C pred_ = C{}, P proj_ = P{}) const
+                {
+                    auto &&pred = invokable(pred_);
+                    auto &&proj = invokable(proj_);
+                    forward_merge_no_buffer_fn::impl(std::move(begin), std::move(middle),
+                        std::move(end), len1, len2, pred, proj);
+                }
+            };
+
+            constexpr forward_merge_no_buffer_fn forward_merge_no_buffer {};
         }
         /// \endcond
 
@@ -192,7 +250,6 @@ namespace ranges
         /// @{
         struct inplace_merge_fn
         {
-            // TODO reimplement to only need forward iterators
             template<typename I, typename S, typename C = ordered_less, typename P = ident,
                 CONCEPT_REQUIRES_(BidirectionalIterator<I>() && Sortable<I, C, P>())>
             I operator()(I begin, I middle, S end, C pred = C{}, P proj = P{}) const
@@ -213,9 +270,37 @@ namespace ranges
                 return len2_and_end.second;
             }
 
+            /// \overload
+            /// Forward iterators: moves the first run aside into a temporary buffer if
+            /// one can be had, and merges by rotations otherwise.
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(!BidirectionalIterator<I>() && Sortable<I, C, P>() &&
+                    IteratorRange<I, S>())>
+            I operator()(I begin, I middle, S end, C pred = C{}, P proj = P{}) const
+            {
+                using value_type = iterator_value_t<I>;
+                auto len1 = distance(begin, middle);
+                auto len2_and_end = enumerate(middle, end);
+                std::pair<value_type*, std::ptrdiff_t> buf{nullptr, 0};
+                std::unique_ptr<value_type, detail::return_temporary_buffer> h;
+                if(0 < len1 && 0 < len2_and_end.first)
+                {
+                    buf = std::get_temporary_buffer<value_type>(len1);
+                    h.reset(buf.first);
+                }
+                if(buf.second >= len1)
+                    aux::merge_n_with_buffer(std::move(begin), len1, std::move(middle),
+                        len2_and_end.first, buf.first, std::move(pred), std::move(proj));
+                else
+                    detail::forward_merge_no_buffer(std::move(begin), std::move(middle),
+                        len2_and_end.second, len1, len2_and_end.first, std::move(pred),
+                        std::move(proj));
+                return len2_and_end.second;
+            }
+
             template<typename Rng, typename C = ordered_less, typename P = ident,
                 typename I = range_iterator_t<Rng>,
-                CONCEPT_REQUIRES_(BidirectionalIterable<Rng &>() && Sortable<I, C, P>())>
+                CONCEPT_REQUIRES_(ForwardIterable<Rng &>() && Sortable<I, C, P>())>
             I operator()(Rng &rng, I middle, C pred = C{}, P proj = P{}) const
             {
                 return (*this)(begin(rng), std::move(middle), end(rng), std::move(pred), std::move(proj));
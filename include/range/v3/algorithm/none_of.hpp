@@ -16,6 +16,7 @@
 
 #include <utility>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/for_each_until.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
@@ -62,7 +63,12 @@ namespace ranges
             bool
             operator()(Rng &&rng, F pred, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+                auto &&ipred = invokable(pred);
+                auto &&iproj = invokable(proj);
+                return for_each_until(rng, [&](range_reference_t<Rng> x)
+                {
+                    return !ipred(iproj(static_cast<range_reference_t<Rng>>(x)));
+                });
             }
         };
 
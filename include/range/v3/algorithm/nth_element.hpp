@@ -97,11 +97,70 @@ namespace ranges
                         ranges::iter_swap(begin, i);
                 }
             }
+
+            // Partitions [begin, end) around the value at begin. On return, [begin, lt) is
+            // less than the pivot, [lt, gt) is equivalent to it and [gt, end) is greater.
+            template<typename I, typename C, typename P>
+            std::pair<I, I> partition3(I begin, I end, C &pred, P &proj)
+            {
+                I lt = ranges::next(begin);
+                for(I k = lt; k != end; ++k)
+                    if(pred(proj(*k), proj(*begin)))
+                        ranges::iter_swap(k, lt++);
+                I gt = lt;
+                for(I k = gt; k != end; ++k)
+                    if(!pred(proj(*begin), proj(*k)))
+                        ranges::iter_swap(k, gt++);
+                ranges::iter_swap(begin, --lt);
+                return {lt, gt};
+            }
+
+            // Median of medians: worst-case linear selection. Slower than quickselect on
+            // typical input, so it is only the fallback for nth_element_fn.
+            template<typename I, typename C, typename P>
+            void median_of_medians_select(I begin, I nth, I end, C &pred, P &proj)
+            {
+                using difference_type = iterator_difference_t<I>;
+                while(nth != end)
+                {
+                    difference_type const len = end - begin;
+                    if(len <= 10)
+                    {
+                        if(len > 1)
+                            detail::selection_sort(begin, end, pred, proj);
+                        return;
+                    }
+                    // Gather the medians of groups of five at the front ...
+                    I medians = begin;
+                    for(I g = begin; g != end; ++medians)
+                    {
+                        I const g_end = end - g > 5 ? g + 5 : end;
+                        detail::selection_sort(g, g_end, pred, proj);
+                        ranges::iter_swap(medians, g + (g_end - g - 1) / 2);
+                        g = g_end;
+                    }
+                    // ... and recursively find their median, which is guaranteed to have at
+                    // least 3/10 of the elements on either side.
+                    I pivot = begin + (medians - begin) / 2;
+                    detail::median_of_medians_select(begin, pivot, medians, pred, proj);
+                    ranges::iter_swap(begin, pivot);
+                    std::pair<I, I> eq = detail::partition3(begin, end, pred, proj);
+                    if(nth < eq.first)
+                        end = eq.first;
+                    else if(nth < eq.second)
+                        return;
+                    else
+                        begin = eq.second;
+                }
+            }
         }
         /// \endcond
 
         /// \addtogroup group-algorithms
         /// @{
+        // Introselect: quickselect with a median-of-3 pivot, falling back to the
+        // median of medians once the partitioning rounds have touched 4*N elements
+        // between them, so the worst case is linear.
         struct nth_element_fn
         {
             template<typename I, typename S, typename C = ordered_less, typename P = ident,
@@ -114,6 +173,7 @@ namespace ranges
                 // C is known to be a reference type
                 using difference_type = iterator_difference_t<I>;
                 difference_type const limit = 7;
+                difference_type work_limit = 4 * (end - begin);
                 while(true)
                 {
                 restart:
@@ -141,6 +201,11 @@ namespace ranges
                         detail::selection_sort(begin, end, pred, proj);
                         return end_orig;
                     }
+                    if((work_limit -= len) < 0)
+                    {
+                        detail::median_of_medians_select(begin, nth, end, pred, proj);
+                        return end_orig;
+                    }
                     // len > limit >= 3
                     I m = begin + len/2;
                     I lm1 = end;
@@ -23,7 +23,8 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/invokable.hpp>
 #include <range/v3/utility/functional.hpp>
-#include <range/v3/algorithm/heap_algorithm.hpp>
+#include <range/v3/algorithm/nth_element.hpp>
+#include <range/v3/algorithm/sort.hpp>
 
 namespace ranges
 {
@@ -31,6 +32,9 @@ namespace ranges
     {
         /// \addtogroup group-algorithms
         /// @{
+        // Quickselect the first (middle - begin) elements into place, then sort just
+        // those. That's O(N + K log K) rather than the O(N log K) of the heap-based
+        // algorithm, and no heap is built.
         struct partial_sort_fn
         {
             template<typename I, typename S, typename C = ordered_less, typename P = ident,
@@ -40,18 +44,10 @@ namespace ranges
                 auto && pred = invokable(pred_);
                 auto && proj = invokable(proj_);
 
-                make_heap(begin, middle, std::ref(pred), std::ref(proj));
-                auto const len = middle - begin;
-                I i = middle;
-                for(; i != end; ++i)
-                {
-                    if(pred(proj(*i), proj(*begin)))
-                    {
-                        iter_swap(i, begin);
-                        detail::sift_down_n(begin, len, begin, std::ref(pred), std::ref(proj));
-                    }
-                }
-                sort_heap(begin, middle, std::ref(pred), std::ref(proj));
+                if(begin == middle)
+                    return next_to(middle, end);
+                I i = nth_element(begin, middle, end, std::ref(pred), std::ref(proj));
+                sort(begin, middle, std::ref(pred), std::ref(proj));
                 return i;
             }
 
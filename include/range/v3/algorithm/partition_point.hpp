@@ -31,6 +31,7 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/invokable.hpp>
+#include <range/v3/algorithm/aux_/prefetch.hpp>
 
 namespace ranges
 {
@@ -51,7 +52,8 @@ namespace ranges
         struct partition_point_fn
         {
             template<typename I, typename S, typename C, typename P = ident,
-                CONCEPT_REQUIRES_(PartitionPointable<I, C, P>() && IteratorRange<I, S>())>
+                CONCEPT_REQUIRES_(!RandomAccessIterator<I>() && PartitionPointable<I, C, P>() &&
+                    IteratorRange<I, S>())>
             I operator()(I begin, S end, C pred_, P proj_ = P{}) const
             {
                 auto && pred = invokable(pred_);
@@ -72,6 +74,29 @@ namespace ranges
                 return begin;
             }
 
+            // Branchless variant: select the next half with a conditional move and
+            // prefetch both candidate probes; see aux::lower_bound_n.
+            template<typename I, typename S, typename C, typename P = ident,
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && PartitionPointable<I, C, P>() &&
+                    IteratorRange<I, S>())>
+            I operator()(I begin, S end, C pred_, P proj_ = P{}) const
+            {
+                auto && pred = invokable(pred_);
+                auto && proj = invokable(proj_);
+                auto len = distance(begin, end);
+                if(len == 0)
+                    return begin;
+                while(len != 1)
+                {
+                    auto const half = len / 2;
+                    detail::prefetch(begin, half / 2);
+                    detail::prefetch(begin, half + half / 2);
+                    begin += pred(proj(*(begin + half))) ? half : 0;
+                    len -= half;
+                }
+                return begin + (pred(proj(*begin)) ? 1 : 0);
+            }
+
             template<typename Rng, typename C, typename P = ident,
                 typename I = range_iterator_t<Rng>,
                 CONCEPT_REQUIRES_(PartitionPointable<I, C, P>() && Iterable<Rng &>())>
@@ -21,6 +21,10 @@
 #ifndef RANGES_V3_ALGORITHM_PERMUTATION_HPP
 #define RANGES_V3_ALGORITHM_PERMUTATION_HPP
 
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
@@ -32,6 +36,8 @@
 #include <range/v3/utility/invokable.hpp>
 #include <range/v3/utility/swap.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/flat_hash_table.hpp>
+#include <range/v3/algorithm/sort.hpp>
 #include <range/v3/algorithm/reverse.hpp>
 
 namespace ranges
@@ -46,31 +52,64 @@ namespace ranges
             ForwardIterator<I2>,
             Comparable<I1, I2, C, P1, P2>>;
 
+        /// \cond
+        namespace detail
+        {
+            // How is_permutation matches up the elements left after the common prefix.
+            struct counted_permutation {}; // count each distinct element in both ranges
+            struct hashed_permutation {};  // count them in a hash table
+            struct sorted_permutation {};  // sort copies of both ranges and compare
+
+            // The elements can be hashed or sorted only if they are compared with == as
+            // they are, and have the same value type.
+            template<typename I1, typename I2, typename C, typename P1, typename P2,
+                typename V = iterator_value_t<I1>>
+            using permutation_check_t =
+                meta::if_c<
+                    !(std::is_same<C, equal_to>::value && std::is_same<P1, ident>::value &&
+                        std::is_same<P2, ident>::value &&
+                        std::is_same<V, iterator_value_t<I2>>::value &&
+                        Convertible<iterator_reference_t<I1>, V>() &&
+                        Convertible<iterator_reference_t<I2>, V>()),
+                    counted_permutation,
+                    meta::if_c<
+                        is_std_hashable<V>::value,
+                        hashed_permutation,
+                        meta::if_c<
+                            TotallyOrdered<V>() && Movable<V>(),
+                            sorted_permutation,
+                            counted_permutation>>>;
+
+            // Below this many elements, counting is faster than hashing or sorting.
+            constexpr std::ptrdiff_t permutation_check_min()
+            {
+                return 32;
+            }
+        }
+        /// \endcond
+
         /// \addtogroup group-algorithms
         /// @{
         struct is_permutation_fn
         {
         private:
-            template<typename I1, typename S1, typename I2, typename S2, typename C, typename P1,
-                typename P2>
-            static bool four_iter_impl(I1 begin1, S1 end1, I2 begin2, S2 end2, C pred_, P1 proj1_,
-                P2 proj2_)
+            struct first_fn
             {
-                auto &&pred = invokable(pred_);
-                auto &&proj1 = invokable(proj1_);
-                auto &&proj2 = invokable(proj2_);
-                // shorten sequences as much as possible by lopping of any equal parts
-                for(; begin1 != end1 && begin2 != end2; ++begin1, ++begin2)
-                    if(!pred(proj1(*begin1), proj2(*begin2)))
-                        goto not_done;
-                return begin1 == end1 && begin2 == end2;
-            not_done:
-                // begin1 != end1 && begin2 != end2 && *begin1 != *begin2
-                auto l1 = distance(begin1, end1);
-                auto l2 = distance(begin2, end2);
-                if(l1 != l2)
-                    return false;
+                template<typename T, typename U>
+                T const &operator()(std::pair<T, U> const &p) const
+                {
+                    return p.first;
+                }
+            };
 
+            // [begin1, end1) and [begin2, end2) both have n elements. Do they hold the
+            // same elements, counting duplicates?
+            template<typename I1, typename S1, typename I2, typename S2, typename C,
+                typename P1, typename P2>
+            static bool same_counts(I1 begin1, S1 end1, I2 begin2, S2 end2,
+                iterator_difference_t<I1>, C &pred, P1 &proj1, P2 &proj2,
+                detail::counted_permutation)
+            {
                 // For each element in [f1, l1) see if there are the same number of
                 //    equal elements in [f2, l2)
                 for(I1 i = begin1; i != end1; ++i)
@@ -100,7 +139,84 @@ namespace ranges
                 return true;
             }
 
+            template<typename I1, typename S1, typename I2, typename S2, typename C,
+                typename P1, typename P2>
+            static bool same_counts(I1 begin1, S1 end1, I2 begin2, S2 end2,
+                iterator_difference_t<I1> n, C &pred, P1 &proj1, P2 &proj2,
+                detail::hashed_permutation)
+            {
+                if(n < detail::permutation_check_min())
+                    return is_permutation_fn::same_counts(std::move(begin1), std::move(end1),
+                        std::move(begin2), std::move(end2), n, pred, proj1, proj2,
+                        detail::counted_permutation{});
+                using V = iterator_value_t<I1>;
+                detail::flat_hash_table<std::pair<V, std::ptrdiff_t>, first_fn> counts;
+                counts.reserve(static_cast<std::size_t>(n));
+                for(; begin1 != end1; ++begin1)
+                    ++counts.entries()[counts.emplace(V(*begin1), 0).first].second;
+                for(; begin2 != end2; ++begin2)
+                {
+                    V const &x = *begin2;
+                    std::size_t const i = counts.find(x);
+                    if(i == counts.size() || --counts.entries()[i].second < 0)
+                        return false;
+                }
+                return true;
+            }
+
+            template<typename I1, typename S1, typename I2, typename S2, typename C,
+                typename P1, typename P2>
+            static bool same_counts(I1 begin1, S1 end1, I2 begin2, S2 end2,
+                iterator_difference_t<I1> n, C &pred, P1 &proj1, P2 &proj2,
+                detail::sorted_permutation)
+            {
+                if(n < detail::permutation_check_min())
+                    return is_permutation_fn::same_counts(std::move(begin1), std::move(end1),
+                        std::move(begin2), std::move(end2), n, pred, proj1, proj2,
+                        detail::counted_permutation{});
+                using V = iterator_value_t<I1>;
+                std::vector<V> v1, v2;
+                v1.reserve(static_cast<std::size_t>(n));
+                v2.reserve(static_cast<std::size_t>(n));
+                for(; begin1 != end1; ++begin1)
+                    v1.push_back(*begin1);
+                for(; begin2 != end2; ++begin2)
+                    v2.push_back(*begin2);
+                ranges::sort(v1);
+                ranges::sort(v2);
+                return v1 == v2;
+            }
+
+            template<typename I1, typename S1, typename I2, typename S2, typename C, typename P1,
+                typename P2>
+            static bool four_iter_impl(I1 begin1, S1 end1, I2 begin2, S2 end2, C pred_, P1 proj1_,
+                P2 proj2_)
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj1 = invokable(proj1_);
+                auto &&proj2 = invokable(proj2_);
+                // shorten sequences as much as possible by lopping of any equal parts
+                for(; begin1 != end1 && begin2 != end2; ++begin1, ++begin2)
+                    if(!pred(proj1(*begin1), proj2(*begin2)))
+                        goto not_done;
+                return begin1 == end1 && begin2 == end2;
+            not_done:
+                // begin1 != end1 && begin2 != end2 && *begin1 != *begin2
+                auto l1 = distance(begin1, end1);
+                auto l2 = distance(begin2, end2);
+                if(l1 != l2)
+                    return false;
+                return is_permutation_fn::same_counts(std::move(begin1), std::move(end1),
+                    std::move(begin2), std::move(end2), l1, pred, proj1, proj2,
+                    detail::permutation_check_t<I1, I2, C, P1, P2>{});
+            }
+
         public:
+            // Once the common prefix is skipped, the remaining elements are counted by
+            // comparing each with all the others, which is quadratic. When they are
+            // compared with == and have the same value type, and there are at least a
+            // few dozen of them, they are counted in a hash table instead if std::hash
+            // supports them, or else sorted if they are totally ordered.
             template<typename I1, typename S1, typename I2, typename C = equal_to,
                 typename P1 = ident, typename P2 = ident,
                 CONCEPT_REQUIRES_(IteratorRange<I1, S1>() && IsPermutationable<I1, I2, C, P1, P2>())>
@@ -121,33 +237,9 @@ namespace ranges
                 if(l1 == 1)
                     return false;
                 I2 end2 = next(begin2, l1);
-                // For each element in [f1, l1) see if there are the same number of
-                //    equal elements in [f2, l2)
-                for(I1 i = begin1; i != end1; ++i)
-                {
-                    // Have we already counted the number of *i in [f1, l1)?
-                    for(I1 j = begin1; j != i; ++j)
-                        if(pred(proj1(*j), proj1(*i)))
-                            goto next_iter;
-                    {
-                        // Count number of *i in [f2, l2)
-                        iterator_difference_t<I1> c2 = 0;
-                        for(I2 j = begin2; j != end2; ++j)
-                            if(pred(proj1(*i), proj2(*j)))
-                                ++c2;
-                        if(c2 == 0)
-                            return false;
-                        // Count number of *i in [i, l1) (we can start with 1)
-                        iterator_difference_t<I1> c1 = 1;
-                        for(I1 j = next(i); j != end1; ++j)
-                            if(pred(proj1(*i), proj1(*j)))
-                                ++c1;
-                        if(c1 != c2)
-                            return false;
-                    }
-            next_iter:;
-                }
-                return true;
+                return is_permutation_fn::same_counts(std::move(begin1), std::move(end1),
+                    std::move(begin2), std::move(end2), l1, pred, proj1, proj2,
+                    detail::permutation_check_t<I1, I2, C, P1, P2>{});
             }
 
             template<typename I1, typename S1, typename I2, typename S2,
@@ -20,25 +20,16 @@
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/swap.hpp>
+#include <range/v3/utility/random.hpp>
 #include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/algorithm/shuffle.hpp>
 
 namespace ranges
 {
     inline namespace v3
     {
-        /// \cond
-        namespace detail
-        {
-            inline unsigned int random_seed_()
-            {
-                RANGES_STATIC_THREAD_LOCAL std::random_device s_rd;
-                return s_rd();
-            }
-        }
-        /// \endcond
-
         /// \addtogroup group-concepts
         /// @{
         namespace concepts
@@ -67,19 +58,7 @@ namespace ranges
             I operator()(I begin, S end_) const
             {
                 I end = next_to(begin, end_);
-                auto d = end - begin;
-                if(d > 1)
-                {
-                    using param_t = std::uniform_int_distribution<std::ptrdiff_t>::param_type;
-                    std::default_random_engine gen(detail::random_seed_());
-                    std::uniform_int_distribution<std::ptrdiff_t> uid;
-                    for(--end, --d; begin < end; ++begin, --d)
-                    {
-                        auto i = uid(gen, param_t{0, d});
-                        if(i != 0)
-                            ranges::iter_swap(begin, begin + i);
-                    }
-                }
+                detail::shuffle_n(std::move(begin), end - begin, detail::random_engine_());
                 return end;
             }
 
@@ -93,7 +72,7 @@ namespace ranges
                 auto d = end - begin;
                 if(d > 1)
                 {
-                    for(--end, --d; begin < end; ++begin, --d)
+                    for(--d; d > 0; ++begin, --d)
                     {
                         auto i = rand(d);
                         ranges::iter_swap(begin, begin + i);
@@ -21,6 +21,7 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/invokable.hpp>
+#include <range/v3/algorithm/aux_/compress_copy_if.hpp>
 
 namespace ranges
 {
@@ -41,7 +42,8 @@ namespace ranges
         struct remove_copy_if_fn
         {
             template<typename I, typename S, typename O, typename C, typename P = ident,
-                CONCEPT_REQUIRES_(RemoveCopyableIf<I, O, C, P>() && IteratorRange<I, S>())>
+                CONCEPT_REQUIRES_(RemoveCopyableIf<I, O, C, P>() && IteratorRange<I, S>() &&
+                    !aux::Compressible<I, S, P>())>
             std::pair<I, O> operator()(I begin, S end, O out, C pred_, P proj_ = P{}) const
             {
                 auto &&pred = invokable(pred_);
@@ -59,6 +61,18 @@ namespace ranges
                 return {begin, out};
             }
 
+            // Branchless variant for contiguous ranges of numbers; see compress_copy_if.
+            template<typename I, typename O, typename C, typename P = ident,
+                CONCEPT_REQUIRES_(RemoveCopyableIf<I, O, C, P>() &&
+                    aux::Compressible<I, I, P>())>
+            std::pair<I, O> operator()(I begin, I end, O out, C pred_, P = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto const n = end - begin;
+                out = aux::compress_copy_if(begin, n, std::move(out), pred, false);
+                return {begin + n, std::move(out)};
+            }
+
             template<typename Rng, typename O, typename C, typename P = ident,
                 typename I = range_iterator_t<Rng>,
                 CONCEPT_REQUIRES_(RemoveCopyableIf<I, O, C, P>() && InputIterable<Rng &>())>
@@ -0,0 +1,281 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_SAMPLE_HPP
+#define RANGES_V3_ALGORITHM_SAMPLE_HPP
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/distance.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/random.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/invokable.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/algorithm/shuffle.hpp>
+#include <range/v3/algorithm/heap_algorithm.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Uniform in the open interval (0, 1), so it's safe to take the log.
+            template<typename Gen>
+            double random_unit(Gen &gen)
+            {
+                std::uniform_real_distribution<double> dist;
+                double u;
+                do
+                    u = dist(gen);
+                while(u == 0.0);
+                return u;
+            }
+        }
+        /// \endcond
+
+        /// \addtogroup group-algorithms
+        /// @{
+        struct sample_fn
+        {
+        private:
+            // Selection sampling (Knuth's Algorithm S): with k elements still to choose
+            // from the remaining r, choose the next with probability k/r. One pass, no
+            // extra memory, and the sample keeps the order of the input.
+            template<typename I, typename S, typename O, typename Gen>
+            static std::pair<I, O> select_n(I begin, S end, iterator_difference_t<I> size, O out,
+                iterator_difference_t<I> n, Gen &gen)
+            {
+                auto rand = detail::make_bounded_random(gen);
+                for(; n > 0 && begin != end; ++begin, --size)
+                {
+                    if(n < size && iterator_difference_t<I>(rand(std::uint64_t(size))) >= n)
+                        continue;
+                    *out = *begin;
+                    ++out;
+                    --n;
+                }
+                return {next_to(begin, end), out};
+            }
+
+            // Reservoir sampling with Li's Algorithm L. After the reservoir fills, the
+            // number of elements to skip before the next replacement is geometric, so
+            // it's drawn directly: a stream of N elements costs O(n(1 + log(N/n)))
+            // random numbers rather than N.
+            template<typename I, typename S, typename O, typename Gen>
+            static std::pair<I, O> reservoir_n(I begin, S end, O out,
+                iterator_difference_t<O> n, Gen &gen)
+            {
+                using D = iterator_difference_t<O>;
+                D k = 0;
+                for(; k < n && begin != end; ++begin, ++k)
+                    out[k] = *begin;
+                if(k < n)
+                    return {begin, out + k};
+                auto rand = detail::make_bounded_random(gen);
+                double w = std::exp(std::log(detail::random_unit(gen)) / double(n));
+                while(true)
+                {
+                    double const s = std::floor(std::log(detail::random_unit(gen)) /
+                        std::log1p(-w));
+                    // A skip too large for 64 bits, or infinite once w has underflowed,
+                    // saturates, and so runs to the end of the stream.
+                    std::uint64_t const max = (std::numeric_limits<std::uint64_t>::max)();
+                    std::uint64_t const skip = s < double(max) ?
+                        static_cast<std::uint64_t>(s) : max;
+                    for(std::uint64_t i = 0; i < skip && begin != end; ++i)
+                        ++begin;
+                    if(begin == end)
+                        break;
+                    out[D(rand(std::uint64_t(n)))] = *begin;
+                    ++begin;
+                    w *= std::exp(std::log(detail::random_unit(gen)) / double(n));
+                }
+                return {begin, out + n};
+            }
+
+        public:
+            /// Copies a uniformly random sample of `min(n, distance(begin, end))` elements
+            /// of `[begin,end)` to `out`. Each subset is equally likely to be chosen.
+            ///
+            /// For forward or sized inputs, the sample is chosen by selection sampling
+            /// and is written in the order of the input. Single-pass inputs, like
+            /// `istream_range`, need a random-access output, because the sample is
+            /// maintained as a reservoir there and overwritten as the stream goes by;
+            /// the elements are then in no particular order.
+            template<typename I, typename S, typename O, typename Gen,
+                CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() &&
+                    WeaklyIncrementable<O>() && IndirectlyCopyable<I, O>() &&
+                    UniformRandomNumberGenerator<Gen>() &&
+                    (ForwardIterator<I>() || SizedIteratorRange<I, S>()))>
+            std::pair<I, O> operator()(I begin, S end, O out, iterator_difference_t<I> n,
+                Gen && gen) const
+            {
+                RANGES_ASSERT(0 <= n);
+                auto const size = distance(begin, end);
+                return sample_fn::select_n(std::move(begin), std::move(end), size,
+                    std::move(out), n, gen);
+            }
+
+            /// \overload
+            template<typename I, typename S, typename O, typename Gen,
+                CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() &&
+                    RandomAccessIterator<O>() && IndirectlyCopyable<I, O>() &&
+                    UniformRandomNumberGenerator<Gen>() &&
+                    !(ForwardIterator<I>() || SizedIteratorRange<I, S>()))>
+            std::pair<I, O> operator()(I begin, S end, O out, iterator_difference_t<O> n,
+                Gen && gen) const
+            {
+                RANGES_ASSERT(0 <= n);
+                return sample_fn::reservoir_n(std::move(begin), std::move(end), std::move(out),
+                    n, gen);
+            }
+
+            /// \overload
+            template<typename I, typename S, typename O,
+                CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>())>
+            auto operator()(I begin, S end, O out, iterator_difference_t<I> n) const ->
+                decltype(std::declval<sample_fn const &>()(std::move(begin), std::move(end),
+                    std::move(out), n, detail::random_engine_()))
+            {
+                return (*this)(std::move(begin), std::move(end), std::move(out), n,
+                    detail::random_engine_());
+            }
+
+            /// \overload
+            template<typename Rng, typename O, typename...Gen,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(Iterable<Rng &>())>
+            auto operator()(Rng &rng, O out, range_difference_t<Rng> n, Gen &&...gen) const ->
+                decltype(std::declval<sample_fn const &>()(begin(rng), end(rng), std::move(out),
+                    n, std::forward<Gen>(gen)...))
+            {
+                return (*this)(begin(rng), end(rng), std::move(out), n,
+                    std::forward<Gen>(gen)...);
+            }
+        };
+
+        /// \sa `sample_fn`
+        /// \ingroup group-algorithms
+        constexpr sample_fn sample{};
+
+        struct weighted_sample_fn
+        {
+        private:
+            // Smaller keys are better, so the heap top is the worst of the sample.
+            struct key_greater
+            {
+                template<typename T>
+                bool operator()(T const &a, T const &b) const
+                {
+                    return a.first > b.first;
+                }
+            };
+
+        public:
+            /// Writes a sample of `min(n, distance(begin, end))` elements to `out`,
+            /// chosen without replacement with probabilities proportional to their
+            /// weights, `proj(*i)`. Weights must be positive; a weight of zero means the
+            /// element is never chosen.
+            ///
+            /// This is Efraimidis and Spirakis' A-ExpJ: element `i` is given the key
+            /// `u^(1/w_i)` for a uniform `u`, and the sample is the `n` elements with the
+            /// largest keys. Rather than draw a key for every element, it draws how much
+            /// weight to skip before the next element that would make it into the sample.
+            /// It makes a single pass and works on input ranges. The sample is written
+            /// in no particular order.
+            template<typename I, typename S, typename O, typename Gen, typename P = ident,
+                typename W = concepts::Invokable::result_t<P, iterator_reference_t<I>>,
+                CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() &&
+                    RandomAccessIterator<O>() && IndirectlyCopyable<I, O>() &&
+                    UniformRandomNumberGenerator<Gen>() && Invokable<P, iterator_reference_t<I>>() &&
+                    std::is_arithmetic<meta::eval<std::decay<W>>>())>
+            std::pair<I, O> operator()(I begin, S end, O out, iterator_difference_t<O> n,
+                Gen && gen, P proj_ = P{}) const
+            {
+                RANGES_ASSERT(0 <= n);
+                using D = iterator_difference_t<O>;
+                auto &&proj = invokable(proj_);
+                if(n == 0)
+                    return {next_to(begin, end), out};
+                // (log key, slot in out), as a min-heap on the key. Keys are kept as
+                // logarithms, log(u) / w, which don't underflow for large weights.
+                std::vector<std::pair<double, D>> heap;
+                heap.reserve(std::size_t(n));
+                for(; D(heap.size()) < n && begin != end; ++begin)
+                {
+                    double const w = double(proj(*begin));
+                    if(!(w > 0))
+                        continue;
+                    D const slot = D(heap.size());
+                    out[slot] = *begin;
+                    heap.emplace_back(std::log(detail::random_unit(gen)) / w, slot);
+                    push_heap(heap, key_greater{});
+                }
+                if(D(heap.size()) < n)
+                    return {begin, out + D(heap.size())};
+                // Skip ahead by weight: the next element to enter the sample is the one at
+                // which the running weight passes log(r) / log key-of-the-worst.
+                double skip = std::log(detail::random_unit(gen)) / heap.front().first;
+                for(; begin != end; ++begin)
+                {
+                    double const w = double(proj(*begin));
+                    if(!(w > 0) || (skip -= w) > 0)
+                        continue;
+                    // This element replaces the worst of the sample. Its key is uniform
+                    // between that of the element it replaces and 1.
+                    double const t = std::exp(heap.front().first * w);
+                    double const r = t + (1 - t) * detail::random_unit(gen);
+                    D const slot = heap.front().second;
+                    pop_heap(heap, key_greater{});
+                    out[slot] = *begin;
+                    heap.back() = std::make_pair(std::log(r) / w, slot);
+                    push_heap(heap, key_greater{});
+                    skip = std::log(detail::random_unit(gen)) / heap.front().first;
+                }
+                return {begin, out + n};
+            }
+
+            /// \overload
+            template<typename Rng, typename O, typename Gen, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(Iterable<Rng &>())>
+            auto operator()(Rng &rng, O out, iterator_difference_t<O> n, Gen && gen,
+                P proj = P{}) const ->
+                decltype(std::declval<weighted_sample_fn const &>()(begin(rng), end(rng),
+                    std::move(out), n, std::forward<Gen>(gen), std::move(proj)))
+            {
+                return (*this)(begin(rng), end(rng), std::move(out), n, std::forward<Gen>(gen),
+                    std::move(proj));
+            }
+        };
+
+        /// \sa `weighted_sample_fn`
+        /// \ingroup group-algorithms
+        constexpr weighted_sample_fn weighted_sample{};
+
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
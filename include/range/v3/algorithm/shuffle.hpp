@@ -14,15 +14,18 @@
 #define RANGES_V3_ALGORITHM_SHUFFLE_HPP
 
 #include <random>
+#include <cstdint>
 #include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/swap.hpp>
+#include <range/v3/utility/random.hpp>
 #include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/algorithm/aux_/prefetch.hpp>
 
 namespace ranges
 {
@@ -46,6 +49,45 @@ namespace ranges
         using UniformRandomNumberGenerator = concepts::models<concepts::UniformRandomNumberGenerator, Gen>;
         /// @}
 
+        /// \cond
+        namespace detail
+        {
+            // Fisher-Yates, front to back: position i is swapped with a position chosen
+            // uniformly from [i, n). The positions are drawn a block at a time, two per
+            // call to the generator when it's wide enough, and the swap targets are
+            // prefetched before any of the block's swaps are done. On arrays much larger
+            // than the cache, that overlaps the misses instead of taking them one by one.
+            template<typename I, typename Gen>
+            void shuffle_n(I begin, iterator_difference_t<I> n, Gen &gen)
+            {
+                using D = iterator_difference_t<I>;
+                constexpr D block = 32;
+                auto rand = detail::make_bounded_random(gen);
+                std::uint64_t idx[block];
+                while(n > 1)
+                {
+                    D const k = n - 1 < block ? n - 1 : block;
+                    D i = 0;
+                    for(; i + 1 < k; i += 2)
+                    {
+                        rand(std::uint64_t(n - i), std::uint64_t(n - i - 1), idx[i], idx[i + 1]);
+                        detail::prefetch(begin, i + D(idx[i]));
+                        detail::prefetch(begin, i + 1 + D(idx[i + 1]));
+                    }
+                    if(i < k)
+                    {
+                        idx[i] = rand(std::uint64_t(n - i));
+                        detail::prefetch(begin, i + D(idx[i]));
+                    }
+                    for(i = 0; i < k; ++i, ++begin)
+                        if(idx[i] != 0)
+                            ranges::iter_swap(begin, begin + D(idx[i]));
+                    n -= k;
+                }
+            }
+        }
+        /// \endcond
+
         /// \addtogroup group-algorithms
         /// @{
         struct shuffle_fn
@@ -57,18 +99,7 @@ namespace ranges
             I operator()(I begin, S end_, Gen && gen) const
             {
                 I end = next_to(begin, end_);
-                auto d = end - begin;
-                if(d > 1)
-                {
-                    using param_t = std::uniform_int_distribution<std::ptrdiff_t>::param_type;
-                    std::uniform_int_distribution<std::ptrdiff_t> uid;
-                    for(--end, --d; begin < end; ++begin, --d)
-                    {
-                        auto i = uid(gen, param_t{0, d});
-                        if(i != 0)
-                            ranges::iter_swap(begin, begin + i);
-                    }
-                }
+                detail::shuffle_n(std::move(begin), end - begin, gen);
                 return end;
             }
 
@@ -36,8 +36,12 @@
 #ifndef RANGES_V3_ALGORITHM_SORT_HPP
 #define RANGES_V3_ALGORITHM_SORT_HPP
 
+#include <cstddef>
+#include <utility>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/distance.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/iterator.hpp>
@@ -46,51 +50,43 @@
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/invokable.hpp>
 #include <range/v3/algorithm/move_backward.hpp>
-#include <range/v3/algorithm/partial_sort.hpp>
 #include <range/v3/algorithm/heap_algorithm.hpp>
+#include <range/v3/algorithm/reverse.hpp>
+#include <range/v3/algorithm/aux_/stable_sort_n.hpp>
 
 namespace ranges
 {
     inline namespace v3
     {
-        /// \cond
-        namespace detail
+        /// \addtogroup group-algorithms
+        /// @{
+
+        /// Tuning parameters for `sort`'s engine, looked up by the iterator's value
+        /// type. Specialize this to override them for a particular type.
+        template<typename T>
+        struct sort_traits
         {
-            template<typename Val, typename C>
-            inline Val const &median(Val const &a, Val const &b, Val const &c, C &pred)
-            {
-                if(pred(a, b))
-                    if(pred(b, c))
-                        return b;
-                    else if(pred(a, c))
-                        return c;
-                    else
-                        return a;
-                else if(pred(a, c))
-                    return a;
-                else if(pred(b, c))
-                    return c;
-                else
-                    return b;
-            }
+            /// Ranges shorter than this are insertion sorted.
+            static constexpr std::ptrdiff_t insertion_sort_threshold() { return 24; }
+            /// Ranges longer than this choose a pivot by Tukey's ninther rather than
+            /// median-of-3.
+            static constexpr std::ptrdiff_t ninther_threshold() { return 128; }
+            /// How many elements an optimistic insertion sort of a seemingly sorted
+            /// partition may move before it gives up.
+            static constexpr std::ptrdiff_t partial_insertion_sort_limit() { return 8; }
+            /// Whether to partition in blocks, trading branches on the comparison
+            /// result for stores. Pays off when comparisons are cheap and
+            /// unpredictable, as for arithmetic keys.
+            static constexpr bool block_partition() { return std::is_arithmetic<T>::value; }
+            /// Elements per block for block partitioning; at most 255.
+            static constexpr std::ptrdiff_t block_size() { return 64; }
+        };
 
-            template<typename I, typename Val, typename C, typename P>
-            inline I unguarded_partition(I begin, I end, Val const &pivot, C &pred, P &proj)
-            {
-                while(true)
-                {
-                    while(pred(proj(*begin), pivot))
-                        ++begin;
-                    --end;
-                    while(pred(pivot, proj(*end)))
-                        --end;
-                    if(!(begin < end))
-                        return begin;
-                    ranges::iter_swap(begin, end);
-                    ++begin;
-                }
-            }
+        /// @}
 
+        /// \cond
+        namespace detail
+        {
             template<typename I, typename C, typename P>
             inline void unguarded_linear_insert(I end, iterator_value_t<I> val, C &pred, P &proj)
             {
@@ -134,55 +130,369 @@ namespace ranges
                 for(I i = begin; i != end; ++i)
                     detail::unguarded_linear_insert(i, iter_move(i), pred, proj);
             }
+
+            // Pattern-defeating quicksort, after Orson Peters' pdqsort.
+            template<typename I, typename Traits>
+            struct pdqsort
+            {
+                using D = iterator_difference_t<I>;
+                using V = iterator_value_t<I>;
+                using R = iterator_common_reference_t<I>;
+
+                template<typename C, typename P>
+                static void sort2(I a, I b, C &pred, P &proj)
+                {
+                    if(pred(proj(R(*b)), proj(R(*a))))
+                        ranges::iter_swap(a, b);
+                }
+
+                template<typename C, typename P>
+                static void sort3(I a, I b, I c, C &pred, P &proj)
+                {
+                    pdqsort::sort2(a, b, pred, proj);
+                    pdqsort::sort2(b, c, pred, proj);
+                    pdqsort::sort2(a, b, pred, proj);
+                }
+
+                // Insertion sort that gives up, returning false, once it has moved more
+                // than partial_insertion_sort_limit() elements.
+                template<typename C, typename P>
+                static bool partial_insertion_sort(I begin, I end, C &pred, P &proj)
+                {
+                    if(begin == end)
+                        return true;
+                    D limit = 0;
+                    for(I cur = next(begin); cur != end; ++cur)
+                    {
+                        I sift = cur, sift_1 = prev(cur);
+                        if(pred(proj(R(*sift)), proj(R(*sift_1))))
+                        {
+                            V tmp = iter_move(sift);
+                            do
+                            {
+                                *sift = iter_move(sift_1);
+                                --sift;
+                            } while(sift != begin && pred(proj(R(tmp)), proj(R(*--sift_1))));
+                            *sift = std::move(tmp);
+                            limit += cur - sift;
+                        }
+                        if(limit > Traits::partial_insertion_sort_limit())
+                            return false;
+                    }
+                    return true;
+                }
+
+                // Partitions [begin, end) around *begin into [begin, pivot) < pivot and
+                // [pivot+1, end) >= pivot. Requires an element >= pivot to the right
+                // of the range or in it. Also reports whether no swaps were needed.
+                template<typename C, typename P>
+                static std::pair<I, bool> partition_right(I begin, I end, C &pred, P &proj)
+                {
+                    V pivot = iter_move(begin);
+                    I first = begin, last = end;
+                    while(pred(proj(R(*++first)), proj(R(pivot))))
+                        ;
+                    if(prev(first) == begin)
+                        while(first < last && !pred(proj(R(*--last)), proj(R(pivot))))
+                            ;
+                    else
+                        while(!pred(proj(R(*--last)), proj(R(pivot))))
+                            ;
+                    bool const already_partitioned = first >= last;
+                    while(first < last)
+                    {
+                        ranges::iter_swap(first, last);
+                        while(pred(proj(R(*++first)), proj(R(pivot))))
+                            ;
+                        while(!pred(proj(R(*--last)), proj(R(pivot))))
+                            ;
+                    }
+                    I pivot_pos = prev(first);
+                    *begin = iter_move(pivot_pos);
+                    *pivot_pos = std::move(pivot);
+                    return {pivot_pos, already_partitioned};
+                }
+
+                static void swap_offsets(I first, I last, unsigned char const *offsets_l,
+                    unsigned char const *offsets_r, D num, bool use_swaps)
+                {
+                    if(use_swaps)
+                    {
+                        // Needed when the same element may be on both sides, so the
+                        // cyclic permutation below could overwrite it.
+                        for(D i = 0; i < num; ++i)
+                            ranges::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+                    }
+                    else if(num > 0)
+                    {
+                        I l = first + offsets_l[0], r = last - offsets_r[0];
+                        V tmp = iter_move(l);
+                        *l = iter_move(r);
+                        for(D i = 1; i < num; ++i)
+                        {
+                            l = first + offsets_l[i];
+                            *r = iter_move(l);
+                            r = last - offsets_r[i];
+                            *l = iter_move(r);
+                        }
+                        *r = std::move(tmp);
+                    }
+                }
+
+                // Like partition_right, but instead of branching on each comparison,
+                // records the offsets of misplaced elements a block at a time and then
+                // swaps them in bulk (Edelkamp and Weiss, "BlockQuicksort").
+                template<typename C, typename P>
+                static std::pair<I, bool> partition_right_block(I begin, I end, C &pred, P &proj)
+                {
+                    static_assert(Traits::block_size() > 0 && Traits::block_size() <= 255,
+                        "sort_traits<T>::block_size() must be in [1, 255]");
+                    constexpr D block_size = Traits::block_size();
+                    V pivot = iter_move(begin);
+                    I first = begin, last = end;
+                    while(pred(proj(R(*++first)), proj(R(pivot))))
+                        ;
+                    if(prev(first) == begin)
+                        while(first < last && !pred(proj(R(*--last)), proj(R(pivot))))
+                            ;
+                    else
+                        while(!pred(proj(R(*--last)), proj(R(pivot))))
+                            ;
+                    bool const already_partitioned = first >= last;
+                    if(!already_partitioned)
+                    {
+                        ranges::iter_swap(first, last);
+                        ++first;
+                        unsigned char offsets_l[block_size], offsets_r[block_size];
+                        I offsets_l_base = first, offsets_r_base = last;
+                        D num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+                        while(first < last)
+                        {
+                            // Fill whichever offset buffers are empty, splitting the
+                            // unknown elements between them if both are.
+                            D const num_unknown = last - first;
+                            D const left_split =
+                                num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+                            D const right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+                            D const left_n = left_split < block_size ? left_split : block_size;
+                            D const right_n = right_split < block_size ? right_split : block_size;
+                            for(D i = 0; i < left_n; ++i)
+                            {
+                                offsets_l[num_l] = static_cast<unsigned char>(i);
+                                num_l += !pred(proj(R(*first)), proj(R(pivot)));
+                                ++first;
+                            }
+                            for(D i = 0; i < right_n; ++i)
+                            {
+                                offsets_r[num_r] = static_cast<unsigned char>(i + 1);
+                                num_r += pred(proj(R(*--last)), proj(R(pivot)));
+                            }
+                            D const num = num_l < num_r ? num_l : num_r;
+                            pdqsort::swap_offsets(offsets_l_base, offsets_r_base,
+                                offsets_l + start_l, offsets_r + start_r, num, num_l == num_r);
+                            num_l -= num;
+                            num_r -= num;
+                            start_l += num;
+                            start_r += num;
+                            if(num_l == 0)
+                            {
+                                start_l = 0;
+                                offsets_l_base = first;
+                            }
+                            if(num_r == 0)
+                            {
+                                start_r = 0;
+                                offsets_r_base = last;
+                            }
+                        }
+                        // At most one buffer still has entries; place them next to the
+                        // boundary.
+                        if(num_l)
+                        {
+                            while(num_l--)
+                                ranges::iter_swap(offsets_l_base + offsets_l[start_l + num_l], --last);
+                            first = last;
+                        }
+                        if(num_r)
+                        {
+                            while(num_r--)
+                                ranges::iter_swap(offsets_r_base - offsets_r[start_r + num_r], first++);
+                        }
+                    }
+                    I pivot_pos = prev(first);
+                    *begin = iter_move(pivot_pos);
+                    *pivot_pos = std::move(pivot);
+                    return {pivot_pos, already_partitioned};
+                }
+
+                // Puts elements equivalent to *begin to the left and greater ones to the
+                // right. Used when the pivot equals the element left of the range, so
+                // that nothing in the range is less than it.
+                template<typename C, typename P>
+                static I partition_left(I begin, I end, C &pred, P &proj)
+                {
+                    V pivot = iter_move(begin);
+                    I first = begin, last = end;
+                    while(pred(proj(R(pivot)), proj(R(*--last))))
+                        ;
+                    if(next(last) == end)
+                        while(first < last && !pred(proj(R(pivot)), proj(R(*++first))))
+                            ;
+                    else
+                        while(!pred(proj(R(pivot)), proj(R(*++first))))
+                            ;
+                    while(first < last)
+                    {
+                        ranges::iter_swap(first, last);
+                        while(pred(proj(R(pivot)), proj(R(*--last))))
+                            ;
+                        while(!pred(proj(R(pivot)), proj(R(*++first))))
+                            ;
+                    }
+                    I pivot_pos = last;
+                    *begin = iter_move(pivot_pos);
+                    *pivot_pos = std::move(pivot);
+                    return pivot_pos;
+                }
+
+                template<typename C, typename P>
+                static void loop(I begin, I end, C &pred, P &proj, int bad_allowed,
+                    bool leftmost = true)
+                {
+                    constexpr D insertion_sort_threshold = Traits::insertion_sort_threshold();
+                    constexpr D ninther_threshold = Traits::ninther_threshold();
+                    while(true)
+                    {
+                        D const size = end - begin;
+                        if(size < insertion_sort_threshold)
+                        {
+                            // Left of anything but the leftmost partition is an element
+                            // no greater than the whole range, which guards the loop.
+                            if(leftmost)
+                                detail::insertion_sort(begin, end, pred, proj);
+                            else
+                                detail::unguarded_insertion_sort(begin, end, pred, proj);
+                            return;
+                        }
+
+                        // Choose a pivot and move it to *begin.
+                        D const s2 = size / 2;
+                        if(size > ninther_threshold)
+                        {
+                            pdqsort::sort3(begin, begin + s2, end - 1, pred, proj);
+                            pdqsort::sort3(begin + 1, begin + (s2 - 1), end - 2, pred, proj);
+                            pdqsort::sort3(begin + 2, begin + (s2 + 1), end - 3, pred, proj);
+                            pdqsort::sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), pred, proj);
+                            ranges::iter_swap(begin, begin + s2);
+                        }
+                        else
+                            pdqsort::sort3(begin + s2, begin, end - 1, pred, proj);
+
+                        // If the pivot equals the element to the left of the range, which
+                        // is no greater than anything in it, then the range holds many
+                        // copies of the pivot. Gather them on the left; they're done.
+                        if(!leftmost && !pred(proj(R(*prev(begin))), proj(R(*begin))))
+                        {
+                            begin = next(pdqsort::partition_left(begin, end, pred, proj));
+                            continue;
+                        }
+
+                        std::pair<I, bool> const part = Traits::block_partition() ?
+                            pdqsort::partition_right_block(begin, end, pred, proj) :
+                            pdqsort::partition_right(begin, end, pred, proj);
+                        I const pivot_pos = part.first;
+
+                        D const l_size = pivot_pos - begin;
+                        D const r_size = end - (pivot_pos + 1);
+                        if(l_size < size / 8 || r_size < size / 8)
+                        {
+                            // A bad partition. After too many of them, switch to heapsort
+                            // to guarantee O(N log N); otherwise break up whatever pattern
+                            // caused it by shuffling a few elements.
+                            if(--bad_allowed == 0)
+                            {
+                                make_heap(begin, end, std::ref(pred), std::ref(proj));
+                                sort_heap(begin, end, std::ref(pred), std::ref(proj));
+                                return;
+                            }
+                            if(l_size >= insertion_sort_threshold)
+                            {
+                                ranges::iter_swap(begin, begin + l_size / 4);
+                                ranges::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+                                if(l_size > ninther_threshold)
+                                {
+                                    ranges::iter_swap(begin + 1, begin + (l_size / 4 + 1));
+                                    ranges::iter_swap(begin + 2, begin + (l_size / 4 + 2));
+                                    ranges::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+                                    ranges::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+                                }
+                            }
+                            if(r_size >= insertion_sort_threshold)
+                            {
+                                ranges::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+                                ranges::iter_swap(end - 1, end - r_size / 4);
+                                if(r_size > ninther_threshold)
+                                {
+                                    ranges::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+                                    ranges::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+                                    ranges::iter_swap(end - 2, end - (1 + r_size / 4));
+                                    ranges::iter_swap(end - 3, end - (2 + r_size / 4));
+                                }
+                            }
+                        }
+                        // A balanced partition that needed no swaps suggests the input
+                        // is already (nearly) sorted; try to finish with insertion sort.
+                        else if(part.second &&
+                            pdqsort::partial_insertion_sort(begin, pivot_pos, pred, proj) &&
+                            pdqsort::partial_insertion_sort(pivot_pos + 1, end, pred, proj))
+                            return;
+
+                        // Recurse on the left, loop on the right.
+                        pdqsort::loop(begin, pivot_pos, pred, proj, bad_allowed, leftmost);
+                        begin = pivot_pos + 1;
+                        leftmost = false;
+                    }
+                }
+            };
         }
         /// \endcond
 
         /// \addtogroup group-algorithms
         /// @{
 
-        // Introsort: Quicksort to a certain depth, then Heapsort. Insertion
-        // sort below a certain threshold.
-        // TODO Forward iterators, like EoP?
+        // Pattern-defeating quicksort: O(N log N) worst case, O(N) on sorted,
+        // reverse-sorted and many-equal-keys inputs, with block partitioning for
+        // cheap comparisons. Tunable via `sort_traits`.
         struct sort_fn
         {
         private:
-            static constexpr int introsort_threshold() { return 16; }
-
-            template<typename I, typename C, typename P>
-            static void final_insertion_sort(I begin, I end, C &pred, P &proj)
-            {
-                if(end - begin > sort_fn::introsort_threshold())
-                {
-                    detail::insertion_sort(begin, begin + sort_fn::introsort_threshold(), pred, proj);
-                    detail::unguarded_insertion_sort(begin + sort_fn::introsort_threshold(), end, pred, proj);
-                }
-                else
-                    detail::insertion_sort(begin, end, pred, proj);
-            }
-
             template<typename Size>
-            static Size log2(Size n)
+            static int log2(Size n)
             {
-                Size k = 0;
-                for(; n != 1; n >>= 1)
+                int k = 0;
+                for(; n > 1; n >>= 1)
                     ++k;
                 return k;
             }
 
-            template<typename I, typename Size, typename C, typename P>
-            static void introsort_loop(I begin, I end, Size depth_limit, C &pred, P &proj)
+            // If the range is one monotonic run, finish it in a single pass. Stops at
+            // the first element that breaks the run, so random input pays O(1).
+            template<typename I, typename C, typename P>
+            static bool sort_monotonic_run(I begin, I end, C &pred, P &proj)
             {
-                while(end - begin > sort_fn::introsort_threshold())
+                I i = next(begin);
+                if(!pred(proj(*i), proj(*begin)))
                 {
-                    if(depth_limit == 0)
-                        return partial_sort(begin, end, end, std::ref(pred), std::ref(proj)), void();
-                    I cut = detail::unguarded_partition(begin, end,
-                        detail::median(proj(*begin), proj(*(begin + (end - begin) / 2)),
-                            proj(*(end - 1)), pred),
-                        pred, proj);
-                    sort_fn::introsort_loop(cut, end, depth_limit - 1, pred, proj);
-                    end = cut;
+                    while(++i != end && !pred(proj(*i), proj(*prev(i))))
+                        ;
+                    return i == end;
                 }
+                while(++i != end && !pred(proj(*prev(i)), proj(*i)))
+                    ;
+                if(i != end)
+                    return false;
+                reverse(begin, end);
+                return true;
             }
 
         public:
@@ -193,17 +503,29 @@ namespace ranges
             {
                 auto &&pred = invokable(pred_);
                 auto &&proj = invokable(proj_);
-                if(begin == end_)
-                    return begin;
                 I end = next_to(begin, end_);
-                sort_fn::introsort_loop(begin, end, sort_fn::log2(end - begin) * 2, pred, proj);
-                sort_fn::final_insertion_sort(begin, end, pred, proj);
+                if(end - begin < 2 || sort_fn::sort_monotonic_run(begin, end, pred, proj))
+                    return end;
+                using Traits = sort_traits<iterator_value_t<I>>;
+                detail::pdqsort<I, Traits>::loop(begin, end, pred, proj,
+                    sort_fn::log2(end - begin));
                 return end;
             }
 
+            // Forward iterators can't be partitioned cheaply, so they get a merge
+            // sort, which is stable as a bonus.
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(Sortable<I, C, P>() && !RandomAccessIterator<I>() &&
+                    IteratorRange<I, S>())>
+            I operator()(I begin, S end, C pred = C{}, P proj = P{}) const
+            {
+                auto n = distance(begin, end);
+                return aux::stable_sort_n(std::move(begin), n, std::move(pred), std::move(proj));
+            }
+
             template<typename Rng, typename C = ordered_less, typename P = ident,
                 typename I = range_iterator_t<Rng>,
-                CONCEPT_REQUIRES_(Sortable<I, C, P>() && RandomAccessIterable<Rng &>())>
+                CONCEPT_REQUIRES_(Sortable<I, C, P>() && ForwardIterable<Rng &>())>
             I operator()(Rng & rng, C pred = C{}, P proj = P{}) const
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
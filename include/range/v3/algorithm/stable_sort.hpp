@@ -40,8 +40,10 @@
 #include <iterator>
 #include <algorithm>
 #include <functional>
+#include <limits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/distance.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/memory.hpp>
@@ -54,11 +56,33 @@
 #include <range/v3/algorithm/merge_move.hpp>
 #include <range/v3/algorithm/sort.hpp>
 #include <range/v3/algorithm/inplace_merge.hpp>
+#include <range/v3/algorithm/move.hpp>
+#include <range/v3/algorithm/reverse.hpp>
+#include <range/v3/algorithm/aux_/gallop_lower_bound.hpp>
+#include <range/v3/algorithm/aux_/gallop_upper_bound.hpp>
+#include <range/v3/algorithm/aux_/stable_sort_n.hpp>
 
 namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            template<typename C>
+            struct flipped_relation
+            {
+                C *pred;
+                template<typename T, typename U>
+                auto operator()(T && t, U && u) const ->
+                    decltype((*pred)(std::forward<U>(u), std::forward<T>(t)))
+                {
+                    return (*pred)(std::forward<U>(u), std::forward<T>(t));
+                }
+            };
+        }
+        /// \endcond
+
         /// \addtogroup group-algorithms
         /// @{
         struct stable_sort_fn
@@ -149,6 +173,176 @@ namespace ranges
                     buffer, buffer_size, std::ref(pred), std::ref(proj));
             }
 
+            // Natural merge sort, after Tim Peters' timsort: split the input into
+            // maximal ascending or strictly descending runs (reversing the latter),
+            // extend short runs to a minimum length with insertion sort, and merge
+            // adjacent runs from a stack whose lengths grow at least like the
+            // Fibonacci numbers. Nearly sorted input takes close to a single pass.
+            static constexpr int min_gallop() { return 7; }
+
+            template<typename D>
+            static D min_run_length(D n)
+            {
+                // Between 32 and 64, chosen so that N / min_run is a power of 2 or a
+                // little below one, which keeps the merges balanced.
+                D r = 0;
+                for(; n >= 64; n >>= 1)
+                    r |= n & 1;
+                return n + r;
+            }
+
+            // Returns the end of the run starting at begin, having made it ascending.
+            template<typename I, typename C, typename P>
+            static I count_run(I begin, I end, C &pred, P &proj)
+            {
+                I i = next(begin);
+                if(i == end)
+                    return i;
+                if(pred(proj(*i), proj(*begin)))
+                {
+                    // Strictly descending, so that reversing it is stable.
+                    while(++i != end && pred(proj(*i), proj(*prev(i))))
+                        ;
+                    reverse(begin, i);
+                }
+                else
+                {
+                    while(++i != end && !pred(proj(*i), proj(*prev(i))))
+                        ;
+                }
+                return i;
+            }
+
+            // Merges [b1, e1) with the range starting at b2 into the output that starts
+            // at out, which ends exactly where [b2, e2) does. Takes from the second
+            // range only when strictly less, so the merge is stable. Once one side
+            // has won min_gallop() times in a row, gallops to find how many more
+            // elements it wins and moves them in one go.
+            template<typename I1, typename I2, typename C, typename P>
+            static void merge_galloping(I1 b1, I1 e1, I2 b2, I2 e2, I2 out, C &pred, P &proj)
+            {
+                int count1 = 0, count2 = 0;
+                while(b1 != e1 && b2 != e2)
+                {
+                    if(count2 >= stable_sort_fn::min_gallop())
+                    {
+                        I2 k = aux::gallop_lower_bound(b2, e2, proj(*b1), std::ref(pred),
+                            std::ref(proj));
+                        out = ranges::move(b2, k, out).second;
+                        b2 = k;
+                        count2 = 0;
+                    }
+                    else if(count1 >= stable_sort_fn::min_gallop())
+                    {
+                        I1 k = aux::gallop_upper_bound(b1, e1, proj(*b2), std::ref(pred),
+                            std::ref(proj));
+                        out = ranges::move(b1, k, out).second;
+                        b1 = k;
+                        count1 = 0;
+                    }
+                    else if(pred(proj(*b2), proj(*b1)))
+                    {
+                        *out = iter_move(b2);
+                        ++out, ++b2, ++count2;
+                        count1 = 0;
+                    }
+                    else
+                    {
+                        *out = iter_move(b1);
+                        ++out, ++b1, ++count1;
+                        count2 = 0;
+                    }
+                }
+                ranges::move(b1, e1, out);
+            }
+
+            // buffer points to raw memory of at least min(middle - begin, end - middle)
+            // elements.
+            template<typename I, typename V, typename C, typename P>
+            static void merge_runs(I begin, I middle, I end, V *buffer, C &pred, P &proj)
+            {
+                // Elements of the left run not greater than the right run's first
+                // are already in place, as are those of the right run not less than
+                // the left run's last.
+                begin = aux::gallop_upper_bound(begin, middle, proj(*middle), std::ref(pred),
+                    std::ref(proj));
+                if(begin == middle)
+                    return;
+                end = aux::gallop_lower_bound(middle, end, proj(*prev(middle)), std::ref(pred),
+                    std::ref(proj));
+                std::unique_ptr<V, detail::destroy_n<V>> h{buffer, {}};
+                auto p = ranges::make_counted_raw_storage_iterator(buffer, h.get_deleter());
+                if(middle - begin <= end - middle)
+                {
+                    p = ranges::move(begin, middle, p).second;
+                    stable_sort_fn::merge_galloping(buffer, p.base().base(), middle, end, begin,
+                        pred, proj);
+                }
+                else
+                {
+                    // Merge from the back, with the order flipped.
+                    p = ranges::move(middle, end, p).second;
+                    using RI = std::reverse_iterator<I>;
+                    using RV = std::reverse_iterator<V *>;
+                    detail::flipped_relation<C> flip{&pred};
+                    stable_sort_fn::merge_galloping(RV{p.base().base()}, RV{buffer}, RI{middle},
+                        RI{begin}, RI{end}, flip, proj);
+                }
+            }
+
+            template<typename I, typename V, typename C, typename P>
+            static void natural_merge_sort(I begin, I end, V *buffer, C &pred, P &proj)
+            {
+                using D = iterator_difference_t<I>;
+                struct run
+                {
+                    I begin;
+                    D size;
+                };
+                // The stack invariants bound its height by log base phi of N.
+                run runs[2 * std::numeric_limits<D>::digits];
+                int n = 0;
+                auto merge_at = [&](int i)
+                {
+                    stable_sort_fn::merge_runs(runs[i].begin, runs[i + 1].begin,
+                        runs[i + 1].begin + runs[i + 1].size, buffer, pred, proj);
+                    runs[i].size += runs[i + 1].size;
+                    if(i + 2 < n)
+                        runs[i + 1] = runs[i + 2];
+                    --n;
+                };
+                D const min_run = stable_sort_fn::min_run_length(end - begin);
+                for(I i = begin; i != end;)
+                {
+                    I run_end = stable_sort_fn::count_run(i, end, pred, proj);
+                    if(run_end - i < min_run)
+                    {
+                        run_end = end - i < min_run ? end : i + min_run;
+                        detail::insertion_sort(i, run_end, pred, proj);
+                    }
+                    runs[n++] = run{i, run_end - i};
+                    i = run_end;
+                    // Restore the invariants, for all of the top four runs:
+                    //   runs[n-3].size > runs[n-2].size + runs[n-1].size
+                    //   runs[n-2].size > runs[n-1].size
+                    while(n > 1)
+                    {
+                        int m = n - 2;
+                        if((m > 0 && runs[m - 1].size <= runs[m].size + runs[m + 1].size) ||
+                           (m > 1 && runs[m - 2].size <= runs[m - 1].size + runs[m].size))
+                        {
+                            if(runs[m - 1].size < runs[m + 1].size)
+                                --m;
+                        }
+                        else if(runs[m].size > runs[m + 1].size)
+                            break;
+                        merge_at(m);
+                    }
+                }
+                while(n > 1)
+                    merge_at(n - 2);
+            }
+
         public:
             template<typename I, typename S, typename C = ordered_less, typename P = ident,
                 CONCEPT_REQUIRES_(Sortable<I, C, P>() && RandomAccessIterator<I>() &&
@@ -161,18 +355,34 @@ namespace ranges
                 using D = iterator_difference_t<I>;
                 using V = iterator_value_t<I>;
                 D len = end - begin;
-                auto buf = len > 256 ? std::get_temporary_buffer<V>(end - begin) : detail::value_init{};
+                if(len < 64)
+                    return detail::insertion_sort(begin, end, pred, proj), end;
+                // A merge never needs to buffer more than the shorter of its two runs.
+                D const want = len / 2 + 1;
+                auto buf = std::get_temporary_buffer<V>(want);
                 std::unique_ptr<V, detail::return_temporary_buffer> h{buf.first};
                 if(buf.first == nullptr)
                     stable_sort_fn::inplace_stable_sort(begin, end, pred, proj);
-                else
+                else if(D(buf.second) < want)
                     stable_sort_fn::stable_sort_adaptive(begin, end, buf.first, D(buf.second), pred, proj);
+                else
+                    stable_sort_fn::natural_merge_sort(begin, end, buf.first, pred, proj);
                 return end;
             }
 
+            // Forward iterators get a top-down merge sort.
+            template<typename I, typename S, typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(Sortable<I, C, P>() && !RandomAccessIterator<I>() &&
+                    IteratorRange<I, S>())>
+            I operator()(I begin, S end, C pred = C{}, P proj = P{}) const
+            {
+                auto n = distance(begin, end);
+                return aux::stable_sort_n(std::move(begin), n, std::move(pred), std::move(proj));
+            }
+
             template<typename Rng, typename C = ordered_less, typename P = ident,
                 typename I = range_iterator_t<Rng>,
-                CONCEPT_REQUIRES_(Sortable<I, C, P>() && RandomAccessIterable<Rng &>())>
+                CONCEPT_REQUIRES_(Sortable<I, C, P>() && ForwardIterable<Rng &>())>
             I operator()(Rng & rng, C pred = C{}, P proj = P{}) const
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
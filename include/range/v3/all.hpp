@@ -18,6 +18,7 @@
 #include <range/v3/algorithm.hpp>
 #include <range/v3/action.hpp>
 #include <range/v3/numeric.hpp>
+#include <range/v3/priority_queue.hpp>
 #include <range/v3/view.hpp>
 
 #endif
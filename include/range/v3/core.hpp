@@ -17,6 +17,7 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/distance.hpp>
 #include <range/v3/empty.hpp>
+#include <range/v3/for_each_until.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_facade.hpp>
 #include <range/v3/range_adaptor.hpp>
@@ -50,6 +50,14 @@
 #endif
 #endif
 
+#ifndef RANGES_PREFETCH
+#if defined(__clang__) || defined(__GNUC__)
+#define RANGES_PREFETCH(ADDR) __builtin_prefetch(ADDR)
+#else
+#define RANGES_PREFETCH(ADDR) ((void)0)
+#endif
+#endif
+
 #if __cplusplus > 201103
 #define RANGES_DEPRECATED(MSG) [[deprecated(MSG)]]
 #else
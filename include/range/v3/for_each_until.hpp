@@ -0,0 +1,96 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_FOR_EACH_UNTIL_HPP
+#define RANGES_V3_FOR_EACH_UNTIL_HPP
+
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_access.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/invokable.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng, typename Fun>
+            auto for_each_until_(Rng &rng, Fun &fun, int) ->
+                decltype(range_access::for_each_until(rng, fun))
+            {
+                return range_access::for_each_until(rng, fun);
+            }
+
+            template<typename Rng, typename Fun>
+            bool for_each_until_(Rng &rng, Fun &fun, long)
+            {
+                auto begin = ranges::begin(rng);
+                auto const end = ranges::end(rng);
+                for(; begin != end; ++begin)
+                    if(!fun(*begin))
+                        return false;
+                return true;
+            }
+
+            // Pushes the elements of each range it is called with to fun.
+            template<typename Fun>
+            struct for_each_until_inner
+            {
+                Fun &fun;
+                template<typename Rng>
+                bool operator()(Rng &&rng) const
+                {
+                    return detail::for_each_until_(rng, fun, 0);
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-core
+        /// @{
+        struct for_each_until_fn
+        {
+            /// Calls `fun` with each element of `rng` in order, until it returns false.
+            /// \return `true` if every element was visited, `false` if `fun` stopped it.
+            ///
+            /// The range drives the loop and pushes its elements to `fun`. A view can
+            /// do that more cheaply than its iterators when they have to keep state
+            /// between steps, like the position in the inner range of a `join_view`. It
+            /// does so by defining `template<typename Fun> bool for_each_until(Fun &fun)`
+            /// (made available to `range_access`), which calls `fun` with the elements
+            /// the range's iterators would yield. Other ranges are walked with their
+            /// iterators. Ranges whose iterators yield prvalues may push them to a `fun`
+            /// that takes rvalue references.
+            template<typename Rng, typename Fun,
+                CONCEPT_REQUIRES_(Iterable<Rng>() &&
+                    InvokablePredicate<Fun, range_reference_t<Rng> &&>())>
+            bool operator()(Rng && rng, Fun && fun_) const
+            {
+                auto &&fun = invokable(fun_);
+                return detail::for_each_until_(rng, fun, 0);
+            }
+        };
+
+        /// \sa `for_each_until_fn`
+        /// \ingroup group-core
+        constexpr for_each_until_fn for_each_until{};
+
+        /// @}
+    }
+}
+
+#endif
@@ -14,7 +14,7 @@
 #ifndef RANGES_V3_ISTREAM_RANGE_HPP
 #define RANGES_V3_ISTREAM_RANGE_HPP
 
-#include <istream>
+#include <iosfwd>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/range_facade.hpp>
 
@@ -32,6 +32,14 @@ namespace ranges
             friend range_access;
             std::istream *sin_;
             Val obj_;
+            // Only <iosfwd> is included here. Testing the stream through a template
+            // defers it to the cursor's instantiation, by which time whoever made the
+            // stream has included its header.
+            template<typename Istream>
+            static bool failed(Istream &sin)
+            {
+                return !sin;
+            }
             struct cursor
             {
             private:
@@ -51,7 +59,7 @@ namespace ranges
                 }
                 bool done() const
                 {
-                    return !*rng_->sin_;
+                    return istream_range::failed(*rng_->sin_);
                 }
             };
             cursor begin_cursor()
@@ -14,6 +14,7 @@
 #define RANGES_V3_NUMERIC_ACCUMULATE_HPP
 
 #include <range/v3/begin_end.hpp>
+#include <range/v3/for_each_until.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/utility/invokable.hpp>
@@ -48,13 +49,22 @@ namespace ranges
                 return init;
             }
 
+            /// \overload
+            /// The range pushes its elements with `for_each_until`, so that nested views
+            /// like `view::for_each` run as nested loops.
             template<typename Rng, typename T, typename Op = plus, typename P = ident,
                 typename I = range_iterator_t<Rng>,
                 CONCEPT_REQUIRES_(Iterable<Rng>() && Accumulateable<I, T, Op, P>())>
-            T operator()(Rng && rng, T init, Op op = Op{}, P proj = P{}) const
+            T operator()(Rng && rng, T init, Op op_ = Op{}, P proj_ = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(init), std::move(op),
-                    std::move(proj));
+                auto &&op = invokable(op_);
+                auto &&proj = invokable(proj_);
+                for_each_until(rng, [&](range_reference_t<Rng> x)
+                {
+                    init = op(init, proj(static_cast<range_reference_t<Rng>>(x)));
+                    return true;
+                });
+                return init;
             }
         };
 
@@ -0,0 +1,187 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_PRIORITY_QUEUE_HPP
+#define RANGES_V3_PRIORITY_QUEUE_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <functional>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/invokable.hpp>
+#include <range/v3/utility/compressed_pair.hpp>
+#include <range/v3/algorithm/heap_algorithm.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-core
+        /// @{
+
+        /// A max-heap of `T`s ordered by `pred(proj(a), proj(b))`, like
+        /// `std::priority_queue` but with projections. The elements are kept in an
+        /// `Arity`-ary heap, which does fewer cache-missing sifts than a binary heap
+        /// once the queue outgrows the cache. `drain()` returns an input range that
+        /// pops the elements off in priority order as it is traversed.
+        template<typename T, typename C = ordered_less, typename P = ident,
+            std::size_t Arity = 4>
+        struct priority_queue
+        {
+        private:
+            std::vector<T> data_;
+            compressed_pair<invokable_t<C>, invokable_t<P>> fns_;
+
+            T *first()
+            {
+                return data_.data();
+            }
+            T *last()
+            {
+                return data_.data() + data_.size();
+            }
+        public:
+            using value_type = T;
+            using size_type = typename std::vector<T>::size_type;
+            using const_reference = T const &;
+
+            struct drain_range
+              : range_facade<drain_range>
+            {
+            private:
+                friend range_access;
+                priority_queue *q_;
+                struct cursor
+                {
+                private:
+                    priority_queue *q_;
+                public:
+                    cursor() = default;
+                    explicit cursor(priority_queue &q)
+                      : q_(&q)
+                    {}
+                    void next()
+                    {
+                        q_->pop();
+                    }
+                    T const &current() const
+                    {
+                        return q_->top();
+                    }
+                    bool done() const
+                    {
+                        return q_->empty();
+                    }
+                };
+                cursor begin_cursor() const
+                {
+                    return cursor{*q_};
+                }
+            public:
+                drain_range() = default;
+                explicit drain_range(priority_queue &q)
+                  : q_(&q)
+                {}
+            };
+
+            priority_queue() = default;
+            explicit priority_queue(C pred, P proj = P{})
+              : data_{}, fns_{invokable(std::move(pred)), invokable(std::move(proj))}
+            {}
+            template<typename Rng,
+                CONCEPT_REQUIRES_(InputIterable<Rng &>())>
+            explicit priority_queue(Rng &&rng, C pred = C{}, P proj = P{})
+              : data_{}, fns_{invokable(std::move(pred)), invokable(std::move(proj))}
+            {
+                // The range's sentinel needn't be its iterator type.
+                for(auto it = begin(rng), e = end(rng); it != e; ++it)
+                    data_.emplace_back(*it);
+                make_dary_heap_fn<Arity>{}(first(), last(), std::ref(fns_.first),
+                    std::ref(fns_.second));
+            }
+            bool empty() const
+            {
+                return data_.empty();
+            }
+            size_type size() const
+            {
+                return data_.size();
+            }
+            void reserve(size_type n)
+            {
+                data_.reserve(n);
+            }
+            void clear()
+            {
+                data_.clear();
+            }
+            /// The greatest element. The queue must not be empty.
+            T const &top() const
+            {
+                RANGES_ASSERT(!empty());
+                return data_.front();
+            }
+            void push(T const &t)
+            {
+                data_.push_back(t);
+                push_dary_heap_fn<Arity>{}(first(), last(), std::ref(fns_.first),
+                    std::ref(fns_.second));
+            }
+            void push(T &&t)
+            {
+                data_.push_back(std::move(t));
+                push_dary_heap_fn<Arity>{}(first(), last(), std::ref(fns_.first),
+                    std::ref(fns_.second));
+            }
+            template<typename...Args>
+            void emplace(Args &&...args)
+            {
+                data_.emplace_back(std::forward<Args>(args)...);
+                push_dary_heap_fn<Arity>{}(first(), last(), std::ref(fns_.first),
+                    std::ref(fns_.second));
+            }
+            /// Removes the greatest element. The queue must not be empty.
+            void pop()
+            {
+                RANGES_ASSERT(!empty());
+                pop_dary_heap_fn<Arity>{}(first(), last(), std::ref(fns_.first),
+                    std::ref(fns_.second));
+                data_.pop_back();
+            }
+            /// Removes the greatest element and returns it. The queue must not be empty.
+            T pop_top()
+            {
+                RANGES_ASSERT(!empty());
+                pop_dary_heap_fn<Arity>{}(first(), last(), std::ref(fns_.first),
+                    std::ref(fns_.second));
+                T t = std::move(data_.back());
+                data_.pop_back();
+                return t;
+            }
+            /// An input range over the elements in priority order. Advancing it pops
+            /// the queue, so a traversal to the end leaves the queue empty.
+            drain_range drain()
+            {
+                return drain_range{*this};
+            }
+        };
+
+        /// @}
+    }
+}
+
+#endif
@@ -103,6 +103,18 @@ namespace ranges
                 return rng.end_adaptor();
             }
 
+            template<typename Rng, typename Fun>
+            static auto for_each_until(Rng & rng, Fun & fun) -> decltype(rng.for_each_until(fun))
+            {
+                return rng.for_each_until(fun);
+            }
+
+            template<typename Rng, typename O>
+            static auto copy(Rng & rng, O out) -> decltype(rng.copy(std::move(out)))
+            {
+                return rng.copy(std::move(out));
+            }
+
             template<typename Cur>
             static auto current(Cur const &pos) noexcept(noexcept(pos.current())) ->
                 decltype(pos.current())
@@ -320,6 +320,7 @@ namespace ranges
         struct equal_to;
         struct less;
         struct ordered_less;
+        struct ordered_greater;
         struct ident;
 
         template<typename Rng, typename Void = void>
@@ -340,6 +341,8 @@ namespace ranges
         template<typename S>
         struct basic_sentinel;
 
+        struct default_sentinel;
+
         template<typename Derived, bool Inf = false>
         struct range_facade;
 
@@ -557,6 +560,16 @@ namespace ranges
             struct reverse_fn;
         }
 
+        template<typename Rng1, typename Rng2, typename C, typename P1, typename P2,
+            template<typename, typename, typename, typename, typename> class Cursor>
+        struct set_algorithm_view;
+
+        namespace view
+        {
+            template<template<typename, typename, typename, typename, typename> class Cursor>
+            struct set_algorithm_fn;
+        }
+
         template<typename Rng>
         struct slice_view;
 
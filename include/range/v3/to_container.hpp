@@ -14,10 +14,15 @@
 #ifndef RANGES_V3_TO_CONTAINER_HPP
 #define RANGES_V3_TO_CONTAINER_HPP
 
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_access.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/common_iterator.hpp>
 
 #ifndef RANGES_NO_STD_FORWARD_DECLARATIONS
@@ -37,7 +42,36 @@ namespace ranges
         /// \cond
         namespace detail
         {
-            template<typename Rng, typename Cont, typename I = range_common_iterator_t<Rng>>
+            // A sized random-access range's end can be computed from its beginning, so
+            // the container can be built from two of its iterators rather than from
+            // common_iterators.
+            template<typename Rng>
+            using end_from_size_t =
+                meta::and_<
+                    RandomAccessIterable<Rng>,
+                    SizedIterable<Rng>,
+                    meta::not_<BoundedIterable<Rng>>>;
+
+            template<typename Rng>
+            using container_iterator_t =
+                meta::if_<
+                    end_from_size_t<Rng>,
+                    range_iterator_t<Rng>,
+                    range_common_iterator_t<Rng>>;
+
+            template<typename Rng>
+            range_iterator_t<Rng> container_end(Rng &rng, std::true_type)
+            {
+                return begin(rng) + static_cast<range_difference_t<Rng>>(size(rng));
+            }
+
+            template<typename Rng>
+            range_sentinel_t<Rng> container_end(Rng &rng, std::false_type)
+            {
+                return end(rng);
+            }
+
+            template<typename Rng, typename Cont, typename I = container_iterator_t<Rng>>
             using ConvertibleToContainer = meta::fast_and<
                 Iterable<Cont>,
                 meta::not_<Range<Cont>>,
@@ -49,6 +83,29 @@ namespace ranges
             struct to_container_fn
               : pipeable<to_container_fn<ContainerMetafunctionClass>>
             {
+            private:
+                // Views that can copy their elements faster than their iterators can
+                // (see `copy_fn`) fill the container through a back_inserter, if it
+                // has push_back.
+                template<typename Cont, typename Rng>
+                static auto to_(Rng &rng, int) ->
+                    decltype((void)std::declval<Cont &>().push_back(
+                            std::declval<range_value_t<Rng>>()),
+                        (void)range_access::copy(rng,
+                            ranges::back_inserter(std::declval<Cont &>())), Cont{})
+                {
+                    Cont cont;
+                    range_access::copy(rng, ranges::back_inserter(cont));
+                    return cont;
+                }
+                template<typename Cont, typename Rng>
+                static Cont to_(Rng &rng, long)
+                {
+                    using I = container_iterator_t<Rng>;
+                    return Cont{I{begin(rng)}, I{container_end(rng,
+                        end_from_size_t<Rng>{})}};
+                }
+            public:
                 template<typename Rng,
                     typename Cont = meta::apply<ContainerMetafunctionClass, range_value_t<Rng>>,
                     CONCEPT_REQUIRES_(Iterable<Rng>() && detail::ConvertibleToContainer<Rng, Cont>())>
@@ -56,8 +113,7 @@ namespace ranges
                 {
                     static_assert(!is_infinite<Rng>::value,
                         "Attempt to convert an infinite range to a container.");
-                    using I = range_common_iterator_t<Rng>;
-                    return Cont{I{begin(rng)}, I{end(rng)}};
+                    return to_container_fn::to_<Cont>(rng, 0);
                 }
             };
         }
@@ -481,6 +481,17 @@ namespace ranges
             {
                 return range_access::equal(pos(), that.pos());
             }
+            // Loops over a range_facade end when the cursor is done(), so ask it
+            // directly rather than through default_sentinel.
+            template<typename Sent>
+            static constexpr bool empty_(Cur const &pos, Sent const &end)
+            {
+                return range_access::empty(pos, end);
+            }
+            static constexpr bool empty_(Cur const &pos, default_sentinel const &)
+            {
+                return range_access::done(pos);
+            }
         public:
             using reference =
                 decltype(range_access::current(std::declval<Cur const &>()));
@@ -534,22 +545,22 @@ namespace ranges
             friend constexpr bool operator==(basic_iterator const &left,
                 basic_sentinel<S> const &right)
             {
-                return range_access::empty(left.pos(), right.end());
+                return basic_iterator::empty_(left.pos(), right.end());
             }
             friend constexpr bool operator!=(basic_iterator const &left,
                 basic_sentinel<S> const &right)
             {
-                return !(left == right);
+                return !basic_iterator::empty_(left.pos(), right.end());
             }
             friend constexpr bool operator==(basic_sentinel<S> const & left,
                 basic_iterator const &right)
             {
-                return range_access::empty(right.pos(), left.end());
+                return basic_iterator::empty_(right.pos(), left.end());
             }
             friend constexpr bool operator!=(basic_sentinel<S> const &left,
                 basic_iterator const &right)
             {
-                return !(left == right);
+                return !basic_iterator::empty_(right.pos(), left.end());
             }
             CONCEPT_REQUIRES(detail::BidirectionalCursor<Cur>())
             basic_iterator& operator--()
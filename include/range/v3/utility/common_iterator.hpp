@@ -15,8 +15,9 @@
 
 #include <type_traits>
 #include <range/v3/range_fwd.hpp>
-#include <range/v3/range_facade.hpp>
 #include <range/v3/utility/concepts.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/variant.hpp>
 
 #ifdef __GNUC__
@@ -33,13 +34,34 @@ namespace ranges
         /// \cond
         namespace detail
         {
-            template<typename I, typename S>
-            struct common_cursor
+            // Whether a sentinel carries no state, so that any two are the same and
+            // one can be made from nothing.
+            template<typename S>
+            struct is_stateless_sentinel
+              : meta::and_<std::is_empty<S>, DefaultConstructible<S>>
+            {};
+
+            template<typename S>
+            struct is_stateless_sentinel<basic_sentinel<S>>
+              : is_stateless_sentinel<S>
+            {};
+
+            // Holds the iterator or the sentinel of a common_cursor: in general a
+            // variant of the two.
+            template<typename I, typename S,
+                bool Stateless = is_stateless_sentinel<S>::value && DefaultConstructible<I>()>
+            struct common_cursor_data
             {
             private:
-                static_assert(!std::is_same<I, S>::value,
-                              "Error: iterator and sentinel types are the same");
                 tagged_variant<I, S> data_;
+            public:
+                common_cursor_data() = default;
+                explicit common_cursor_data(I it)
+                  : data_(meta::size_t<0>{}, std::move(it))
+                {}
+                explicit common_cursor_data(S se)
+                  : data_(meta::size_t<1>{}, std::move(se))
+                {}
                 bool is_sentinel() const
                 {
                     RANGES_ASSERT(data_.is_valid());
@@ -60,6 +82,72 @@ namespace ranges
                     RANGES_ASSERT(is_sentinel());
                     return ranges::get<1>(data_);
                 }
+            };
+
+            // A stateless sentinel needn't be stored, so keep the iterator and a flag
+            // instead of a variant. Reading the iterator is then a plain member access,
+            // and comparing two positions tests a bool rather than dispatching on the
+            // variant's index.
+            template<typename I, typename S>
+            struct common_cursor_data<I, S, true>
+            {
+            private:
+                I it_;
+                bool is_sentinel_;
+            public:
+                common_cursor_data()
+                  : it_(), is_sentinel_(false)
+                {}
+                explicit common_cursor_data(I it)
+                  : it_(std::move(it)), is_sentinel_(false)
+                {}
+                explicit common_cursor_data(S)
+                  : it_(), is_sentinel_(true)
+                {}
+                bool is_sentinel() const
+                {
+                    return is_sentinel_;
+                }
+                I & it()
+                {
+                    RANGES_ASSERT(!is_sentinel());
+                    return it_;
+                }
+                I const & it() const
+                {
+                    RANGES_ASSERT(!is_sentinel());
+                    return it_;
+                }
+                S se() const
+                {
+                    RANGES_ASSERT(is_sentinel());
+                    return S{};
+                }
+            };
+
+            template<typename I, typename S>
+            struct common_cursor
+            {
+            private:
+                static_assert(!std::is_same<I, S>::value,
+                              "Error: iterator and sentinel types are the same");
+                common_cursor_data<I, S> data_;
+                bool is_sentinel() const
+                {
+                    return data_.is_sentinel();
+                }
+                I & it()
+                {
+                    return data_.it();
+                }
+                I const & it() const
+                {
+                    return data_.it();
+                }
+                auto se() const -> decltype(data_.se())
+                {
+                    return data_.se();
+                }
                 // http://gcc.gnu.org/bugzilla/show_bug.cgi?id=60799
                 #ifdef __GNUC__
              public:
@@ -105,10 +193,10 @@ namespace ranges
                 };
                 common_cursor() = default;
                 explicit common_cursor(I it)
-                  : data_(meta::size_t<0>{}, std::move(it))
+                  : data_(std::move(it))
                 {}
                 explicit common_cursor(S se)
-                  : data_(meta::size_t<1>{}, std::move(se))
+                  : data_(std::move(se))
                 {}
                 template<typename I2, typename S2,
                     CONCEPT_REQUIRES_(Convertible<I, I2>() &&
@@ -116,8 +204,8 @@ namespace ranges
                 operator common_cursor<I2, S2>() const
                 {
                     return is_sentinel() ?
-                        common_cursor<I2, S2>{I2{se()}} :
-                        common_cursor<I2, S2>{S2{it()}};
+                        common_cursor<I2, S2>{S2{se()}} :
+                        common_cursor<I2, S2>{I2{it()}};
                 }
                 auto current() const -> decltype(*std::declval<I const &>())
                 {
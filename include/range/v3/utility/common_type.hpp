@@ -36,7 +36,7 @@ namespace ranges
         namespace detail
         {
             template<typename T, typename U>
-            std::true_type has_common(T*, U*, decltype(true? std::declval<T>() : std::declval<U>())* = 0);
+            std::true_type has_common(T*, U*, decltype((void)(true? std::declval<T>() : std::declval<U>()))* = 0);
             std::false_type has_common(...);
 
             template<typename T, typename U>
@@ -67,6 +67,13 @@ namespace ranges
               : common_type_if<T, U>
             {};
 
+            // By far the most common case, and it needs no conditional expression.
+            template<typename T>
+            struct common_type2<T, T, T, T>
+            {
+                using type = T;
+            };
+
             template<typename Meta, typename Enable = void>
             struct has_type
               : std::false_type
@@ -165,7 +172,7 @@ namespace ranges
 
         template<typename T, typename U>
         struct common_reference<T, U>
-          : detail::common_reference_if<T, U>
+          : meta::if_c<RANGES_META_IS_SAME(T, U), meta::id<T>, detail::common_reference_if<T, U>>
         {};
 
         template<typename T, typename U, typename... Vs>
@@ -107,6 +107,19 @@ namespace ranges
                 static constexpr bool value{meta::fast_and<Bools...>::value};
             };
 
+            // The conjunction of the base concepts, each checked against Ts. This is
+            // a direct pack expansion rather than a meta::transform over the list of
+            // bases, because it is instantiated for every concept check.
+            template<typename Bases, typename...Ts>
+            struct models_bases_
+            {};
+
+            template<typename...Bases, typename...Ts>
+            struct models_bases_<meta::list<Bases...>, Ts...>
+            {
+                using type = lazy_and<concepts::models<Bases, Ts...>...>;
+            };
+
             template<typename...Ts>
             auto models_(any) ->
                 std::false_type;
@@ -114,11 +127,7 @@ namespace ranges
             template<typename...Ts, typename Concept,
                 typename = decltype(std::declval<Concept &>().template requires_<Ts...>(std::declval<Ts>()...))>
             auto models_(Concept *) ->
-                meta::apply_list<
-                    meta::quote<lazy_and>,
-                    meta::transform<
-                        base_concepts_of_t<Concept>,
-                        meta::bind_back<meta::quote<concepts::models>, Ts...>>>;
+                meta::eval<models_bases_<base_concepts_of_t<Concept>, Ts...>>;
 
             template<typename Concept, typename...Ts>
             struct models_result
@@ -579,7 +588,7 @@ namespace ranges
 
                 template<typename Fun, typename T, typename U,
                     enable_if_t<std::is_same<T, U>::value> = 0>
-                auto requires_(Fun fun, T t, T u) -> decltype(
+                auto requires_(Fun fun, T t, U u) -> decltype(
                     concepts::valid_expr(
                         concepts::model_of<Predicate>(val<Fun>(), val<T>(), val<U>())
                     ));
@@ -0,0 +1,190 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_FLAT_HASH_TABLE_HPP
+#define RANGES_V3_UTILITY_FLAT_HASH_TABLE_HPP
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <functional>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/functional.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // The types whose std::hash specializations are guaranteed to exist.
+            template<typename T>
+            struct is_std_hashable
+              : meta::or_c<std::is_integral<T>::value, std::is_pointer<T>::value>
+            {};
+            template<> struct is_std_hashable<std::string> : std::true_type {};
+            template<> struct is_std_hashable<std::wstring> : std::true_type {};
+            template<> struct is_std_hashable<std::u16string> : std::true_type {};
+            template<> struct is_std_hashable<std::u32string> : std::true_type {};
+
+            // Whether std::hash<T> can hash a T, including through user
+            // specializations. is_std_hashable only holds for the types that are
+            // guaranteed to be hashable.
+            template<typename T, typename = void>
+            struct is_hashable
+              : std::false_type
+            {};
+
+            template<typename T>
+            struct is_hashable<T, void_t<decltype(std::hash<T>{}(std::declval<T const &>()))>>
+              : std::true_type
+            {};
+
+            struct std_hash
+            {
+                template<typename T>
+                std::size_t operator()(T const &t) const
+                {
+                    return std::hash<T>{}(t);
+                }
+            };
+
+            // An open-addressing hash table with linear probing. The entries live densely
+            // in a vector, in insertion order; the probe sequence runs over a separate
+            // array of (hash, index) slots, so a lookup touches one or two cache lines
+            // of slots and only reads an entry when the full hashes match. std::hash is
+            // the identity for integers on common implementations, so the bucket is taken
+            // from the high bits of the hash times a large odd constant.
+            template<typename Entry, typename KeyOf = ident, typename Hash = std_hash,
+                typename Eq = equal_to>
+            struct flat_hash_table
+            {
+            private:
+                struct slot
+                {
+                    std::size_t hash;
+                    std::size_t index; // one past the entry's index, or 0 if empty
+                };
+                std::vector<Entry> entries_;
+                std::vector<slot> slots_;
+                // Set by rehash() for the number of slots; 63 until there are any.
+                unsigned shift_ = 63;
+                KeyOf key_of_;
+                Hash hash_;
+                Eq eq_;
+
+                std::size_t bucket(std::size_t h) const
+                {
+                    return std::size_t((std::uint64_t(h) * 0x9E3779B97F4A7C15ull) >> shift_);
+                }
+                // The slot holding k, or the empty slot where it would go.
+                template<typename K>
+                std::pair<std::size_t, bool> probe(K const &k, std::size_t h) const
+                {
+                    RANGES_ASSERT(!slots_.empty());
+                    std::size_t const mask = slots_.size() - 1;
+                    for(std::size_t i = bucket(h);; i = (i + 1) & mask)
+                    {
+                        slot const &s = slots_[i];
+                        if(s.index == 0)
+                            return {i, false};
+                        if(s.hash == h && eq_(key_of_(entries_[s.index - 1]), k))
+                            return {i, true};
+                    }
+                }
+                void rehash(std::size_t nslots)
+                {
+                    unsigned shift = 64;
+                    for(std::size_t n = nslots; n > 1; n >>= 1)
+                        --shift;
+                    std::vector<slot> old(nslots, slot{0, 0});
+                    old.swap(slots_);
+                    shift_ = shift;
+                    std::size_t const mask = slots_.size() - 1;
+                    for(slot const &s : old)
+                        if(s.index != 0)
+                        {
+                            std::size_t i = bucket(s.hash);
+                            while(slots_[i].index != 0)
+                                i = (i + 1) & mask;
+                            slots_[i] = s;
+                        }
+                }
+            public:
+                flat_hash_table() = default;
+                explicit flat_hash_table(KeyOf key_of, Hash hash = Hash{}, Eq eq = Eq{})
+                  : key_of_(std::move(key_of)), hash_(std::move(hash)), eq_(std::move(eq))
+                {}
+                std::size_t size() const
+                {
+                    return entries_.size();
+                }
+                std::vector<Entry> &entries()
+                {
+                    return entries_;
+                }
+                std::vector<Entry> const &entries() const
+                {
+                    return entries_;
+                }
+                // Make room for n entries without rehashing. The table stays at most half
+                // full.
+                void reserve(std::size_t n)
+                {
+                    std::size_t nslots = 16;
+                    while(nslots < 2 * n)
+                        nslots *= 2;
+                    if(nslots > slots_.size())
+                        rehash(nslots);
+                }
+                void clear()
+                {
+                    entries_.clear();
+                    for(slot &s : slots_)
+                        s = slot{0, 0};
+                }
+                // The index of the entry with key k, or size() if there is none.
+                template<typename K>
+                std::size_t find(K const &k) const
+                {
+                    if(entries_.empty())
+                        return entries_.size();
+                    auto const p = probe(k, hash_(k));
+                    return p.second ? slots_[p.first].index - 1 : entries_.size();
+                }
+                // If there is no entry with key k, add Entry(k, args...). Returns the index
+                // of the entry with key k and whether it was added.
+                template<typename K, typename...Args>
+                std::pair<std::size_t, bool> emplace(K &&k, Args &&...args)
+                {
+                    if(2 * (entries_.size() + 1) > slots_.size())
+                        rehash(slots_.empty() ? 16 : 2 * slots_.size());
+                    std::size_t const h = hash_(k);
+                    auto const p = probe(k, h);
+                    if(p.second)
+                        return {slots_[p.first].index - 1, false};
+                    entries_.emplace_back(std::forward<K>(k), std::forward<Args>(args)...);
+                    slots_[p.first] = slot{h, entries_.size()};
+                    return {entries_.size() - 1, true};
+                }
+            };
+        }
+        /// \endcond
+    }
+}
+
+#endif
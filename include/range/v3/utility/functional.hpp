@@ -58,6 +58,16 @@ namespace ranges
             }
         };
 
+        struct ordered_greater
+        {
+            template<typename T, typename U,
+                CONCEPT_REQUIRES_(TotallyOrdered<T, U>())>
+            constexpr bool operator()(T && t, U && u) const
+            {
+                return (U &&) u < (T &&) t;
+            }
+        };
+
         struct ident
         {
             template<typename T>
@@ -17,6 +17,24 @@
 #include <type_traits>
 #include <range/v3/utility/nullptr_v.hpp>
 
+/// \cond
+// Compiler builtins for the hottest metafunctions. Each replaces a class template
+// instantiation (or a recursion) with a single step in the compiler. GCC can't
+// mangle __is_same, so RANGES_META_IS_SAME must not appear in function signatures,
+// where and_c and or_c often end up.
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 10)
+#define RANGES_META_IS_SAME(...) __is_same(__VA_ARGS__)
+#else
+#define RANGES_META_IS_SAME(...) std::is_same<__VA_ARGS__>::value
+#endif
+
+#if defined(__has_builtin)
+#if __has_builtin(__type_pack_element)
+#define RANGES_META_TYPE_PACK_ELEMENT 1
+#endif
+#endif
+/// \endcond
+
 namespace ranges
 {
     inline namespace v3
@@ -49,7 +67,7 @@ namespace ranges
 
             /// \brief Evaluate the Metafunction Class `F` with the arguments \c Args.
             template<typename F, typename...Args>
-            using apply = typename meta_detail::apply_impl<F, Args...>;
+            using apply = eval<meta_detail::apply_impl<F, Args...>>;
 
             /// \brief A metafunction that evaluates the Metafunction Class `F` with
             /// the arguments \c Args.
@@ -271,80 +289,79 @@ namespace ranges
             /// \cond
             namespace meta_detail
             {
-                // Thanks to  Louis Dionne for this clever hack for a quick-to-compile
-                // implementation of and_c and or_c
-                std::true_type fast_and_impl_();
-
-                template<typename ...T>
-                std::true_type fast_and_impl_(T*...);
-
-                template<typename ...T>
-                std::false_type fast_and_impl_(T...);
-
-                std::false_type fast_or_impl_();
-
-                template<typename ...T>
-                std::false_type fast_or_impl_(T*...);
-
-                template<typename ...T>
-                std::true_type fast_or_impl_(T...);
-
-                template<typename ...Bools>
-                struct _and_;
+                // Each step peels off one parameter and switches on its value directly,
+                // so that short-circuiting costs one instantiation per parameter
+                // evaluated, and none for the rest.
+                template<bool Continue, typename...Bools>
+                struct _and_impl_
+                  : std::false_type
+                {};
 
                 template<>
-                struct _and_<>
+                struct _and_impl_<true>
                   : std::true_type
                 {};
 
                 template<typename Bool, typename...Bools>
-                struct _and_<Bool, Bools...>
-                  : if_c<!Bool::type::value, std::false_type, _and_<Bools...>>
+                struct _and_impl_<true, Bool, Bools...>
+                  : _and_impl_<Bool::type::value, Bools...>
                 {};
 
-                template<typename ...Bools>
-                struct _or_;
+                template<typename...Bools>
+                using _and_ = _and_impl_<true, Bools...>;
+
+                template<bool Continue, typename...Bools>
+                struct _or_impl_
+                  : std::true_type
+                {};
 
                 template<>
-                struct _or_<>
+                struct _or_impl_<true>
                   : std::false_type
                 {};
 
                 template<typename Bool, typename...Bools>
-                struct _or_<Bool, Bools...>
-                  : if_c<Bool::type::value, std::true_type, _or_<Bools...>>
+                struct _or_impl_<true, Bool, Bools...>
+                  : _or_impl_<!Bool::type::value, Bools...>
                 {};
 
-                template<bool ...Bools>
-                struct and_c_impl
-                {
-                    using type = decltype(meta_detail::fast_and_impl_(if_c<Bools, int*, int>{}...));
-                };
-
                 template<typename...Bools>
-                struct fast_and_helper
-                {
-                    using type = and_c_impl<Bools::type::value...>;
-                };
+                using _or_ = _or_impl_<true, Bools...>;
             }
             /// \endcond
 
             /// \addtogroup group-meta
             /// @{
 
-            /// \brief Logically and together all the Boolean parameters
+            /// \brief Logically and together all the Boolean parameters. The parameters
+            /// are compared, all at once, with a sequence of as many \c true values, so
+            /// this costs one type comparison whatever their number.
             template<bool ...Bools>
-            using and_c = meta_detail::and_c_impl<Bools...>;
+            using and_c = bool_<std::is_same<
+                integer_sequence<bool, Bools...>,
+                integer_sequence<bool, (Bools || true)...>>::value>;
 
             /// \brief Logically or together all the Boolean parameters
             template<bool ...Bools>
-            using or_c =
-                decltype(meta_detail::fast_or_impl_(if_c<Bools, int, int*>{}...));
+            using or_c = bool_<!std::is_same<
+                integer_sequence<bool, Bools...>,
+                integer_sequence<bool, (Bools && false)...>>::value>;
 
             /// \brief Logically negate the Boolean parameter
             template<bool Bool>
             using not_c = bool_<!Bool>;
 
+            /// \cond
+            namespace meta_detail
+            {
+                template<typename...Bools>
+                struct fast_and_helper
+                {
+                    using type = and_c<Bools::type::value...>;
+                };
+            }
+            /// \endcond
+
             /// \brief Logically and together all the integral constant-wrapped Boolean
             /// parameters, <i>without</i> doing short-circuiting.
             template<typename...Bools>
@@ -500,6 +517,18 @@ namespace ranges
                     static T eval(VoidPtrs..., T *, Us *...);
                 };
 
+            #ifdef RANGES_META_TYPE_PACK_ELEMENT
+                template<typename N, typename List, typename Enable = void>
+                struct list_element_
+                {};
+
+                template<typename N, typename...Ts>
+                struct list_element_<N, list<Ts...>,
+                    typename std::enable_if<(N::type::value < sizeof...(Ts))>::type>
+                {
+                    using type = __type_pack_element<N::type::value, Ts...>;
+                };
+            #else
                 template<typename N, typename List>
                 struct list_element_
                 {};
@@ -508,6 +537,7 @@ namespace ranges
                 struct list_element_<N, list<Ts...>>
                   : decltype(list_element_impl_<repeat_n<N, void *>>::eval(_nullptr_v<id<Ts>>()...))
                 {};
+            #endif
             }
             /// \endcond
 
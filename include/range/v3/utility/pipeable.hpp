@@ -103,6 +103,7 @@ namespace ranges
             struct impl : Pipeable
             {
                 using Pipeable::pipe;
+                using Pipeable::compose;
             };
  
             template<typename Pipeable>
@@ -123,6 +124,18 @@ namespace ranges
             (
                 std::forward<Pipe>(pipe)(std::forward<Arg>(arg))
             )
+            // Default Compose behavior makes a pipe that passes its argument through
+            // the two pipes in turn
+            template<typename Pipe0, typename Pipe1>
+            static auto compose(Pipe0 && pipe0, Pipe1 && pipe1)
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                make_pipeable(std::bind(
+                    bitwise_or{},
+                    std::bind(bitwise_or{}, std::placeholders::_1, bind_forward<Pipe0>(pipe0)),
+                    bind_forward<Pipe1>(pipe1)
+                ))
+            )
         };
 
         // Evaluate the pipe with an argument
@@ -140,11 +153,8 @@ namespace ranges
         auto operator|(Pipe0 && pipe0, Pipe1 && pipe1)
         RANGES_DECLTYPE_AUTO_RETURN
         (
-            make_pipeable(std::bind(
-                bitwise_or{},
-                std::bind(bitwise_or{}, std::placeholders::_1, bind_forward<Pipe0>(pipe0)),
-                bind_forward<Pipe1>(pipe1)
-            ))
+            pipeable_access::impl<Pipe0>::compose(std::forward<Pipe0>(pipe0),
+                std::forward<Pipe1>(pipe1))
         )
 
         /// @}
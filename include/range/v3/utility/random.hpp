@@ -0,0 +1,177 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_RANDOM_HPP
+#define RANGES_V3_UTILITY_RANDOM_HPP
+
+#include <limits>
+#include <random>
+#include <cstdint>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            inline unsigned int random_seed_()
+            {
+                RANGES_STATIC_THREAD_LOCAL std::random_device s_rd;
+                return s_rd();
+            }
+
+            // The engine used by the algorithms that don't take one. It is seeded once
+            // per thread rather than once per call.
+            inline std::mt19937_64 &random_engine_()
+            {
+                RANGES_STATIC_THREAD_LOCAL std::mt19937_64 s_gen(
+                    (std::uint64_t(random_seed_()) << 32) | random_seed_());
+                return s_gen;
+            }
+
+            // How many uniformly random bits each call to Gen yields: 32 or 64 if the
+            // generator covers every bit pattern of that width (as std::mt19937 and
+            // std::mt19937_64 do), or 0 if it doesn't or we can't tell at compile time.
+            template<typename Gen, typename = void>
+            struct random_bits_
+              : std::integral_constant<int, 0>
+            {};
+
+            template<typename Gen>
+            struct random_bits_<Gen, void_t<
+                std::integral_constant<decltype(Gen::min()), Gen::min()>,
+                std::integral_constant<decltype(Gen::max()), Gen::max()>>>
+              : std::integral_constant<int,
+                    Gen::min() != 0 ? 0 :
+#ifdef __SIZEOF_INT128__
+                    std::uint64_t(Gen::max()) == ~std::uint64_t(0) ? 64 :
+#endif
+                    std::uint64_t(Gen::max()) == 0xFFFFFFFFu ? 32 : 0>
+            {};
+
+            // Uniformly distributed integers in [0, bound) drawn from Gen, for bound > 0.
+            // The general case defers to std::uniform_int_distribution.
+            template<typename Gen, int Bits = random_bits_<Gen>::value>
+            struct bounded_random
+            {
+                Gen &gen_;
+                std::uint64_t operator()(std::uint64_t bound) const
+                {
+                    using param_t = std::uniform_int_distribution<std::uint64_t>::param_type;
+                    return std::uniform_int_distribution<std::uint64_t>{}(gen_,
+                        param_t{0, bound - 1});
+                }
+                // Two indices at once, in [0, bound0) and [0, bound1).
+                void operator()(std::uint64_t bound0, std::uint64_t bound1, std::uint64_t &i0,
+                    std::uint64_t &i1) const
+                {
+                    i0 = (*this)(bound0);
+                    i1 = (*this)(bound1);
+                }
+            };
+
+            // Lemire's multiply-and-shift: the high half of gen() * bound is the result,
+            // and the low half tells us when it would be biased. That only happens with
+            // probability bound / 2^32, so the division that computes the exact
+            // rejection threshold is almost never executed. Bounds that don't fit in 32
+            // bits take the general case.
+            template<typename Gen>
+            struct bounded_random<Gen, 32>
+            {
+                Gen &gen_;
+                std::uint64_t operator()(std::uint64_t bound_) const
+                {
+                    RANGES_ASSERT(0 < bound_);
+                    if(bound_ > 0xFFFFFFFFu)
+                        return bounded_random<Gen, 0>{gen_}(bound_);
+                    std::uint32_t const bound = static_cast<std::uint32_t>(bound_);
+                    std::uint64_t m = std::uint64_t(std::uint32_t(gen_())) * bound;
+                    if(std::uint32_t(m) < bound)
+                    {
+                        std::uint32_t const t = std::uint32_t(-bound) % bound;
+                        while(std::uint32_t(m) < t)
+                            m = std::uint64_t(std::uint32_t(gen_())) * bound;
+                    }
+                    return m >> 32;
+                }
+                void operator()(std::uint64_t bound0, std::uint64_t bound1, std::uint64_t &i0,
+                    std::uint64_t &i1) const
+                {
+                    i0 = (*this)(bound0);
+                    i1 = (*this)(bound1);
+                }
+            };
+
+#ifdef __SIZEOF_INT128__
+            template<typename Gen>
+            struct bounded_random<Gen, 64>
+            {
+                Gen &gen_;
+                std::uint64_t operator()(std::uint64_t bound) const
+                {
+                    using u128 = unsigned __int128;
+                    u128 m = u128(std::uint64_t(gen_())) * bound;
+                    if(std::uint64_t(m) < bound)
+                    {
+                        std::uint64_t const t = -bound % bound;
+                        while(std::uint64_t(m) < t)
+                            m = u128(std::uint64_t(gen_())) * bound;
+                    }
+                    return std::uint64_t(m >> 64);
+                }
+                // When bound0 * bound1 fits in 64 bits, one draw yields both indices: the
+                // high half of x * bound0 is the first, and the low half, which is still
+                // uniform, is multiplied by bound1 for the second. The leftover low bits
+                // are checked against the rejection threshold for the product.
+                void operator()(std::uint64_t bound0, std::uint64_t bound1, std::uint64_t &i0,
+                    std::uint64_t &i1) const
+                {
+                    using u128 = unsigned __int128;
+                    if(bound0 > ~std::uint64_t(0) / bound1)
+                    {
+                        i0 = (*this)(bound0);
+                        i1 = (*this)(bound1);
+                        return;
+                    }
+                    std::uint64_t const product = bound0 * bound1;
+                    u128 m0 = u128(std::uint64_t(gen_())) * bound0;
+                    u128 m1 = u128(std::uint64_t(m0)) * bound1;
+                    if(std::uint64_t(m1) < product)
+                    {
+                        std::uint64_t const t = -product % product;
+                        while(std::uint64_t(m1) < t)
+                        {
+                            m0 = u128(std::uint64_t(gen_())) * bound0;
+                            m1 = u128(std::uint64_t(m0)) * bound1;
+                        }
+                    }
+                    i0 = std::uint64_t(m0 >> 64);
+                    i1 = std::uint64_t(m1 >> 64);
+                }
+            };
+#endif
+
+            template<typename Gen>
+            bounded_random<Gen> make_bounded_random(Gen &gen)
+            {
+                return {gen};
+            }
+        }
+        /// \endcond
+    }
+}
+
+#endif
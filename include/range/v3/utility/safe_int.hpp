@@ -163,7 +163,7 @@ namespace ranges
                     ++i_;
                 return *this;
             }
-            safe_int & operator++(int) noexcept
+            safe_int operator++(int) noexcept
             {
                 auto tmp = *this;
                 ++*this;
@@ -175,7 +175,7 @@ namespace ranges
                     --i_;
                 return *this;
             }
-            safe_int & operator--(int) noexcept
+            safe_int operator--(int) noexcept
             {
                 auto tmp = *this;
                 --*this;
@@ -75,12 +75,13 @@ namespace ranges
 
             // Now implementations
             template <typename T, typename U>
-            std::true_type is_swappable_helper(T* t, U* u, decltype(swap(*t, *u))* = 0);
-            std::false_type is_swappable_helper(...);
+            std::true_type is_swappable_helper(int, decltype((void)swap(std::declval<T>(), std::declval<U>()))* = 0);
+            template <typename T, typename U>
+            std::false_type is_swappable_helper(long);
 
             template<typename T, typename U>
             struct is_swappable_
-              : decltype(is_swappable_helper((T*)0, (U*)0))
+              : decltype(is_swappable_helper<T, U>(42))
             {};
 
             template<typename T, typename U, bool Swappable>
@@ -90,7 +91,7 @@ namespace ranges
 
             template<typename T, typename U>
             struct is_nothrow_swappable_helper<T, U, true>
-              //: meta::bool_<noexcept(swap(std::declval<T>(), std::declval<U>()))>
+              : meta::bool_<noexcept(swap(std::declval<T>(), std::declval<U>()))>
             {};
 
             template<typename T, typename U>
@@ -142,8 +143,14 @@ namespace ranges
             //    std::reference_wrapper<T>. How do I make it model IndirectlySwappable?
             // A: With an overload of indirect_swap.
 
-            template <typename Readable0, typename Readable1>
+            template <typename Readable0, typename Readable1, typename Enable = void>
             struct is_dereferenced_swappable
+              : std::false_type
+            {};
+
+            template <typename Readable0, typename Readable1>
+            struct is_dereferenced_swappable<Readable0, Readable1,
+                detail::void_t<decltype(*std::declval<Readable0>()), decltype(*std::declval<Readable1>())>>
               : is_swappable_<decltype(*std::declval<Readable0>()),
                               decltype(*std::declval<Readable1>())>
             {};
@@ -208,12 +215,9 @@ namespace ranges
             //    properly constrain std::iter_swap and rename this.
 
             template<typename Readable0, typename Readable1>
-            typename std::enable_if<
-                is_swappable<decltype(*std::declval<Readable0>()),
-                             decltype(*std::declval<Readable1>())>::value>::type
+            typename std::enable_if<is_dereferenced_swappable<Readable0, Readable1>::value>::type
             indirect_swap(Readable0 a, Readable1 b)
-                noexcept(is_nothrow_swappable<decltype(*std::declval<Readable0>()),
-                                              decltype(*std::declval<Readable1>())>::value)
+                noexcept(is_dereferenced_nothrow_swappable<Readable0, Readable1>::value)
             {
                 swap(*a, *b);
             }
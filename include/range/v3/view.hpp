@@ -24,6 +24,7 @@
 #include <range/v3/view/const.hpp>
 #include <range/v3/view/counted.hpp>
 #include <range/v3/view/delimit.hpp>
+#include <range/v3/view/distinct.hpp>
 #include <range/v3/view/drop.hpp>
 #include <range/v3/view/drop_while.hpp>
 #include <range/v3/view/empty.hpp>
@@ -32,11 +33,13 @@
 #include <range/v3/view/generate.hpp>
 #include <range/v3/view/generate_n.hpp>
 #include <range/v3/view/group_by.hpp>
+#include <range/v3/view/hash_join.hpp>
 #include <range/v3/view/indirect.hpp>
 #include <range/v3/view/intersperse.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/join.hpp>
 #include <range/v3/view/map.hpp>
+#include <range/v3/view/merge_join.hpp>
 #include <range/v3/view/move.hpp>
 #include <range/v3/view/partial_sum.hpp>
 #include <range/v3/view/repeat.hpp>
@@ -45,13 +48,17 @@
 #include <range/v3/view/replace.hpp>
 #include <range/v3/view/replace_if.hpp>
 #include <range/v3/view/reverse.hpp>
+#include <range/v3/view/sample.hpp>
+#include <range/v3/view/set_algorithm.hpp>
 #include <range/v3/view/single.hpp>
 #include <range/v3/view/slice.hpp>
+#include <range/v3/view/sorted.hpp>
 #include <range/v3/view/split.hpp>
 #include <range/v3/view/stride.hpp>
 #include <range/v3/view/tail.hpp>
 #include <range/v3/view/take.hpp>
 #include <range/v3/view/take_while.hpp>
+#include <range/v3/view/top_k.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/view/tokenize.hpp>
 #include <range/v3/view/unbounded.hpp>
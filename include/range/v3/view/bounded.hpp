@@ -19,7 +19,9 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/range_access.hpp>
 #include <range/v3/range_interface.hpp>
+#include <range/v3/utility/meta.hpp>
 #include <range/v3/utility/pipeable.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/common_iterator.hpp>
@@ -42,10 +44,29 @@ namespace ranges
             using base_range_t = view::all_t<Rng>;
             using base_iterator_t = range_iterator_t<base_range_t>;
             using base_sentinel_t = range_sentinel_t<base_range_t>;
+            // When the end can be computed from the beginning and the size, the
+            // iterators need not be common_iterators.
+            using end_from_size_t =
+                meta::and_<RandomAccessIterable<base_range_t>, SizedIterable<base_range_t>>;
             base_range_t rng_;
 
+            template<typename BaseRng>
+            static range_iterator_t<BaseRng> end_(BaseRng &rng, std::true_type)
+            {
+                return ranges::begin(rng) +
+                    static_cast<range_difference_t<BaseRng>>(ranges::size(rng));
+            }
+            template<typename BaseRng>
+            static range_sentinel_t<BaseRng> end_(BaseRng &rng, std::false_type)
+            {
+                return ranges::end(rng);
+            }
         public:
-            using iterator = common_iterator<base_iterator_t, base_sentinel_t>;
+            using iterator =
+                meta::if_<
+                    end_from_size_t,
+                    base_iterator_t,
+                    common_iterator<base_iterator_t, base_sentinel_t>>;
 
             bounded_view() = default;
             explicit bounded_view(Rng && rng)
@@ -57,7 +78,7 @@ namespace ranges
             }
             iterator end()
             {
-                return iterator{ranges::end(rng_)};
+                return iterator{bounded_view::end_(rng_, end_from_size_t{})};
             }
             CONCEPT_REQUIRES(Range<base_range_t const>())
             iterator begin() const
@@ -67,7 +88,7 @@ namespace ranges
             CONCEPT_REQUIRES(Range<base_range_t const>())
             iterator end() const
             {
-                return iterator{ranges::end(rng_)};
+                return iterator{bounded_view::end_(rng_, end_from_size_t{})};
             }
             CONCEPT_REQUIRES(SizedRange<base_range_t>())
             range_size_t<base_range_t> size() const
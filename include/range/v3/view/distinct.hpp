@@ -0,0 +1,159 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_DISTINCT_HPP
+#define RANGES_V3_VIEW_DISTINCT_HPP
+
+#include <utility>
+#include <functional>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/utility/invokable.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/flat_hash_table.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// The elements of a range whose projected keys haven't been seen before, in
+        /// their original order. Unlike `view::unique`, duplicates needn't be adjacent:
+        /// the keys seen so far are kept in a hash set, so the input doesn't need to be
+        /// sorted. The set lives in the view and is reset by `begin()`, so the view is
+        /// single-pass.
+        template<typename Rng, typename P>
+        struct distinct_view
+          : range_facade<distinct_view<Rng, P>>
+        {
+        private:
+            friend range_access;
+            using key_t = meta::eval<std::decay<
+                concepts::Invokable::result_t<P, range_reference_t<Rng>>>>;
+            view::all_t<Rng> rng_;
+            semiregular_invokable_t<P> proj_;
+            detail::flat_hash_table<key_t> seen_;
+
+            struct cursor
+            {
+            private:
+                distinct_view *rng_;
+                range_iterator_t<Rng> it_;
+                // Skip the elements whose keys are already in the set.
+                void satisfy()
+                {
+                    auto const end = ranges::end(rng_->rng_);
+                    for(; it_ != end; ++it_)
+                        if(rng_->seen_.emplace(rng_->proj_(*it_)).second)
+                            break;
+                }
+            public:
+                using single_pass = std::true_type;
+                cursor() = default;
+                explicit cursor(distinct_view &rng)
+                  : rng_(&rng), it_(ranges::begin(rng.rng_))
+                {
+                    satisfy();
+                }
+                auto current() const -> decltype(*it_)
+                {
+                    return *it_;
+                }
+                void next()
+                {
+                    ++it_;
+                    satisfy();
+                }
+                bool done() const
+                {
+                    return it_ == ranges::end(rng_->rng_);
+                }
+            };
+            cursor begin_cursor()
+            {
+                seen_.clear();
+                return cursor{*this};
+            }
+        public:
+            distinct_view() = default;
+            distinct_view(Rng && rng, P proj)
+              : rng_(view::all(std::forward<Rng>(rng)))
+              , proj_(invokable(std::move(proj)))
+            {}
+        };
+
+        namespace view
+        {
+            struct distinct_fn
+            {
+            private:
+                friend view_access;
+                template<typename P, CONCEPT_REQUIRES_(!Iterable<P>())>
+                static auto bind(distinct_fn distinct, P proj)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(distinct, std::placeholders::_1, protect(std::move(proj))))
+                )
+            public:
+                template<typename Rng, typename P,
+                    typename X = concepts::Invokable::result_t<P, range_reference_t<Rng>>>
+                using Concept = meta::and_<
+                    InputIterable<Rng>,
+                    Invokable<P, range_reference_t<Rng>>,
+                    EqualityComparable<X>,
+                    detail::is_hashable<meta::eval<std::decay<X>>>>;
+
+                template<typename Rng, typename P = ident,
+                    CONCEPT_REQUIRES_(Concept<Rng, P>())>
+                distinct_view<Rng, P> operator()(Rng && rng, P proj = P{}) const
+                {
+                    return {std::forward<Rng>(rng), std::move(proj)};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename P = ident,
+                    CONCEPT_REQUIRES_(!Concept<Rng, P>())>
+                void operator()(Rng &&, P = P{}) const
+                {
+                    CONCEPT_ASSERT_MSG(InputIterable<Rng>(),
+                        "The object on which view::distinct operates must be a model of the "
+                        "InputIterable concept.");
+                    CONCEPT_ASSERT_MSG(Invokable<P, range_reference_t<Rng>>(),
+                        "The projection passed to view::distinct must be callable with the "
+                        "range's reference type.");
+                    using X = concepts::Invokable::result_t<P, range_reference_t<Rng>>;
+                    CONCEPT_ASSERT_MSG(EqualityComparable<X>() &&
+                        detail::is_hashable<meta::eval<std::decay<X>>>(),
+                        "The keys of the elements of the range passed to view::distinct, or "
+                        "the elements themselves if no projection is specified, must be "
+                        "equality comparable and hashable with std::hash.");
+                }
+            #endif
+            };
+
+            /// \relates distinct_fn
+            /// \ingroup group-views
+            constexpr view<distinct_fn> distinct{};
+        }
+        /// @}
+    }
+}
+
+#endif
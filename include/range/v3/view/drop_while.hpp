@@ -19,6 +19,7 @@
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/range_access.hpp>
 #include <range/v3/range_interface.hpp>
 #include <range/v3/utility/optional.hpp>
 #include <range/v3/utility/pipeable.hpp>
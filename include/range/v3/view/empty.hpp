@@ -67,6 +67,11 @@ namespace ranges
             {
                 return {};
             }
+            template<typename Fun>
+            constexpr bool for_each_until(Fun &) const
+            {
+                return true;
+            }
         public:
             empty_view() = default;
         };
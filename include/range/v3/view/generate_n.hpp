@@ -78,6 +78,15 @@ namespace ranges
                 RANGES_ASSERT(!!gen_);
                 return {*gen_, n_};
             }
+            template<typename Fun>
+            bool for_each_until(Fun &fun)
+            {
+                RANGES_ASSERT(!!gen_);
+                for(std::size_t n = n_; n != 0; --n)
+                    if(!fun((*gen_)()))
+                        return false;
+                return true;
+            }
         public:
             generate_n_view() = default;
             explicit generate_n_view(G g, std::size_t n)
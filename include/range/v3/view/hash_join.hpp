@@ -0,0 +1,312 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_HASH_JOIN_HPP
+#define RANGES_V3_VIEW_HASH_JOIN_HPP
+
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <functional>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/invokable.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/flat_hash_table.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+#include <range/v3/view/zip.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// The inner join of two ranges on their projected keys, which needn't be sorted:
+        /// a pair of references for every element of the probe range (the second) and
+        /// every element of the build range (the first) with an equal key, in the order
+        /// of the probe range and then of the build range.
+        ///
+        /// The first call to `begin()` indexes the build range in an open-addressing hash
+        /// table of its distinct keys. Each key maps to a contiguous run of iterators to
+        /// its elements, so a lookup reads the table's slot array and then one run of
+        /// matches. The build range must be forward and should be the smaller of the two;
+        /// the probe range is only traversed lazily, and may be single-pass. The key type
+        /// of the build range must be hashable with `std::hash`, and the probe range's
+        /// keys must convert to it.
+        template<typename Rng1, typename Rng2, typename P1, typename P2>
+        struct hash_join_view
+          : range_facade<hash_join_view<Rng1, Rng2, P1, P2>>
+        {
+        private:
+            friend range_access;
+            using base1_t = view::all_t<Rng1>;
+            using base2_t = view::all_t<Rng2>;
+            using I1 = range_iterator_t<base1_t>;
+            using key_t = meta::eval<std::decay<
+                concepts::Invokable::result_t<P1, range_reference_t<base1_t>>>>;
+
+            // A distinct key of the build range, and its run [begin, end) in rows_.
+            struct group
+            {
+                key_t key;
+                std::size_t begin, end;
+                template<typename K>
+                explicit group(K && k)
+                  : key(std::forward<K>(k)), begin(0), end(0)
+                {}
+            };
+            struct key_of
+            {
+                key_t const &operator()(group const &g) const
+                {
+                    return g.key;
+                }
+            };
+
+            base1_t rng1_;
+            base2_t rng2_;
+            semiregular_invokable_t<P1> proj1_;
+            semiregular_invokable_t<P2> proj2_;
+            detail::flat_hash_table<group, key_of> groups_;
+            std::vector<I1> rows_;
+            bool built_ = false;
+
+            static void reserve(std::vector<I1> &, std::vector<std::size_t> &,
+                detail::flat_hash_table<group, key_of> &, base1_t &, std::false_type)
+            {}
+            static void reserve(std::vector<I1> &its, std::vector<std::size_t> &row_groups,
+                detail::flat_hash_table<group, key_of> &groups, base1_t &rng, std::true_type)
+            {
+                std::size_t const n = static_cast<std::size_t>(size(rng));
+                its.reserve(n);
+                row_groups.reserve(n);
+                groups.reserve(n);
+            }
+            void build()
+            {
+                std::vector<I1> its;
+                std::vector<std::size_t> row_groups;
+                hash_join_view::reserve(its, row_groups, groups_, rng1_, SizedIterable<base1_t>());
+                for(auto it = begin(rng1_), e = end(rng1_); it != e; ++it)
+                {
+                    std::size_t const g = groups_.emplace(proj1_(*it)).first;
+                    ++groups_.entries()[g].end;
+                    its.push_back(it);
+                    row_groups.push_back(g);
+                }
+                // Counting sort the rows by group, so that each group's rows are
+                // contiguous and stay in the order of the build range.
+                std::size_t n = 0;
+                for(group &g : groups_.entries())
+                {
+                    g.begin = n;
+                    n += g.end;
+                    g.end = g.begin;
+                }
+                rows_.resize(its.size());
+                for(std::size_t i = 0; i < its.size(); ++i)
+                    rows_[groups_.entries()[row_groups[i]].end++] = its[i];
+                built_ = true;
+            }
+
+            struct cursor
+            {
+            private:
+                using I2 = range_iterator_t<base2_t>;
+                using reference_t_ =
+                    std::pair<range_reference_t<base1_t>, range_reference_t<base2_t>>;
+                hash_join_view *rng_;
+                I2 it2_;
+                // The matches of *it2_ are rows_[pos_, end_).
+                std::size_t pos_, end_;
+
+                // Skip the elements of the probe range that have no match.
+                void satisfy()
+                {
+                    auto const end2 = ranges::end(rng_->rng2_);
+                    auto const &groups = rng_->groups_;
+                    for(; it2_ != end2; ++it2_)
+                    {
+                        std::size_t const g =
+                            groups.find(static_cast<key_t const &>(rng_->proj2_(*it2_)));
+                        if(g != groups.size())
+                        {
+                            pos_ = groups.entries()[g].begin;
+                            end_ = groups.entries()[g].end;
+                            return;
+                        }
+                    }
+                }
+            public:
+                using single_pass = SinglePass<I2>;
+                using value_type = std::pair<range_value_t<base1_t>, range_value_t<base2_t>>;
+                using common_reference =
+                    meta::eval<detail::common_tuple_ref<
+                        detail::remove_rvalue_reference_t<reference_t_> const &,
+                        value_type &>>;
+                cursor() = default;
+                explicit cursor(hash_join_view &rng)
+                  : rng_(&rng), it2_(ranges::begin(rng.rng2_)), pos_(0), end_(0)
+                {
+                    satisfy();
+                }
+                reference_t_ current() const
+                {
+                    return reference_t_{*rng_->rows_[pos_], *it2_};
+                }
+                void next()
+                {
+                    if(++pos_ != end_)
+                        return;
+                    ++it2_;
+                    satisfy();
+                }
+                bool done() const
+                {
+                    return it2_ == ranges::end(rng_->rng2_);
+                }
+                CONCEPT_REQUIRES(ForwardIterator<I2>())
+                bool equal(cursor const &that) const
+                {
+                    return it2_ == that.it2_ && pos_ == that.pos_;
+                }
+            };
+            void reset()
+            {
+                groups_ = {};
+                rows_.clear();
+                built_ = false;
+            }
+            cursor begin_cursor()
+            {
+                if(!built_)
+                    build();
+                return cursor{*this};
+            }
+        public:
+            hash_join_view() = default;
+            hash_join_view(Rng1 && rng1, Rng2 && rng2, P1 proj1, P2 proj2)
+              : rng1_(view::all(std::forward<Rng1>(rng1)))
+              , rng2_(view::all(std::forward<Rng2>(rng2)))
+              , proj1_(invokable(std::move(proj1)))
+              , proj2_(invokable(std::move(proj2)))
+            {}
+            // rows_ holds iterators into rng1_, which may own its elements, so copies
+            // index their own build range on their first begin().
+            hash_join_view(hash_join_view &&that)
+              : rng1_(std::move(that).rng1_)
+              , rng2_(std::move(that).rng2_)
+              , proj1_(std::move(that).proj1_)
+              , proj2_(std::move(that).proj2_)
+            {}
+            hash_join_view(hash_join_view const &that)
+              : rng1_(that.rng1_)
+              , rng2_(that.rng2_)
+              , proj1_(that.proj1_)
+              , proj2_(that.proj2_)
+            {}
+            hash_join_view& operator=(hash_join_view &&that)
+            {
+                rng1_ = std::move(that).rng1_;
+                rng2_ = std::move(that).rng2_;
+                proj1_ = std::move(that).proj1_;
+                proj2_ = std::move(that).proj2_;
+                reset();
+                return *this;
+            }
+            hash_join_view& operator=(hash_join_view const &that)
+            {
+                rng1_ = that.rng1_;
+                rng2_ = that.rng2_;
+                proj1_ = that.proj1_;
+                proj2_ = that.proj2_;
+                reset();
+                return *this;
+            }
+        };
+
+        namespace view
+        {
+            struct hash_join_fn
+            {
+            private:
+                friend view_access;
+                template<typename Rng2, typename...Rest,
+                    CONCEPT_REQUIRES_(Iterable<Rng2>() && !meta::or_<Iterable<Rest>...>())>
+                static auto bind(hash_join_fn hash_join, Rng2 && rng2, Rest &&...rest)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(hash_join, std::placeholders::_1,
+                        all(std::forward<Rng2>(rng2)), protect(std::forward<Rest>(rest))...))
+                )
+            public:
+                template<typename Rng1, typename Rng2, typename P1, typename P2,
+                    typename X1 = concepts::Invokable::result_t<P1, range_reference_t<Rng1>>,
+                    typename X2 = concepts::Invokable::result_t<P2, range_reference_t<Rng2>>,
+                    typename K = meta::eval<std::decay<X1>>>
+                using Concept = meta::and_<
+                    ForwardIterable<Rng1>,
+                    InputIterable<Rng2>,
+                    Invokable<P1, range_reference_t<Rng1>>,
+                    Invokable<P2, range_reference_t<Rng2>>,
+                    EqualityComparable<K>,
+                    Convertible<X2, K>>;
+
+                template<typename Rng1, typename Rng2, typename P1 = ident, typename P2 = ident,
+                    CONCEPT_REQUIRES_(Concept<Rng1, Rng2, P1, P2>())>
+                hash_join_view<Rng1, Rng2, P1, P2>
+                operator()(Rng1 && rng1, Rng2 && rng2, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+                {
+                    return {std::forward<Rng1>(rng1), std::forward<Rng2>(rng2), std::move(proj1),
+                        std::move(proj2)};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng1, typename Rng2, typename P1 = ident, typename P2 = ident,
+                    CONCEPT_REQUIRES_(!Concept<Rng1, Rng2, P1, P2>() &&
+                        Iterable<Rng1>() && Iterable<Rng2>())>
+                void operator()(Rng1 &&, Rng2 &&, P1 = P1{}, P2 = P2{}) const
+                {
+                    CONCEPT_ASSERT_MSG(ForwardIterable<Rng1>(),
+                        "The build range passed to view::hash_join must be a model of the "
+                        "ForwardIterable concept, because its elements are indexed by "
+                        "iterator.");
+                    CONCEPT_ASSERT_MSG(InputIterable<Rng2>(),
+                        "The probe range passed to view::hash_join must be a model of the "
+                        "InputIterable concept.");
+                    CONCEPT_ASSERT_MSG(Invokable<P1, range_reference_t<Rng1>>() &&
+                        Invokable<P2, range_reference_t<Rng2>>(),
+                        "The key projections passed to view::hash_join must be callable with "
+                        "the reference types of the build and probe ranges, respectively.");
+                }
+            #endif
+            };
+
+            /// \relates hash_join_fn
+            /// \ingroup group-views
+            constexpr view<hash_join_fn> hash_join{};
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -19,8 +19,10 @@
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/size.hpp>
 #include <range/v3/numeric.hpp> // for accumulate
+#include <range/v3/empty.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/for_each_until.hpp>
 #include <range/v3/range_adaptor.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/utility/pipeable.hpp>
@@ -125,6 +127,15 @@ namespace ranges
 #endif
             }
             // TODO: could support const iteration if range_reference_t<Rng> is a true reference.
+
+            // Loop over each inner range in turn, rather than keeping it in cur_ between
+            // steps and checking for its end on every one.
+            template<typename Fun>
+            bool for_each_until(Fun &fun)
+            {
+                return ranges::for_each_until(this->base(),
+                    detail::for_each_until_inner<Fun>{fun});
+            }
         public:
             join_view() = default;
             explicit join_view(Rng &&rng)
@@ -0,0 +1,237 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_MERGE_JOIN_HPP
+#define RANGES_V3_VIEW_MERGE_JOIN_HPP
+
+#include <utility>
+#include <functional>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/invokable.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/algorithm/aux_/gallop_lower_bound.hpp>
+#include <range/v3/algorithm/aux_/gallop_upper_bound.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+#include <range/v3/view/zip.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// The inner join of two ranges sorted by their projected keys: a pair of
+        /// references for every element of the first range and every element of the
+        /// second with an equivalent key, in the order of the first range and then of the
+        /// second. Runs of equal keys in the second range are replayed for each element of
+        /// the first with that key, so the second range must be forward. Mismatched keys
+        /// are skipped by galloping, as in `view::set_intersection`.
+        template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+        struct merge_join_view
+          : range_facade<merge_join_view<Rng1, Rng2, C, P1, P2>>
+        {
+        private:
+            friend range_access;
+            using base1_t = view::all_t<Rng1>;
+            using base2_t = view::all_t<Rng2>;
+            base1_t rng1_;
+            base2_t rng2_;
+            semiregular_invokable_t<C> pred_;
+            semiregular_invokable_t<P1> proj1_;
+            semiregular_invokable_t<P2> proj2_;
+
+            template<bool IsConst>
+            struct cursor
+            {
+            private:
+                using view_t = meta::apply<meta::add_const_if_c<IsConst>, merge_join_view>;
+                using rng1_t = meta::apply<meta::add_const_if_c<IsConst>, base1_t>;
+                using rng2_t = meta::apply<meta::add_const_if_c<IsConst>, base2_t>;
+                using I1 = range_iterator_t<rng1_t>;
+                using S1 = range_sentinel_t<rng1_t>;
+                using I2 = range_iterator_t<rng2_t>;
+                using S2 = range_sentinel_t<rng2_t>;
+                using reference_t_ =
+                    std::pair<range_reference_t<rng1_t>, range_reference_t<rng2_t>>;
+                semiregular_invokable_ref_t<C, IsConst> pred_;
+                semiregular_invokable_ref_t<P1, IsConst> proj1_;
+                semiregular_invokable_ref_t<P2, IsConst> proj2_;
+                I1 it1_;
+                S1 end1_;
+                // [first2_, last2_) is the run of the second range whose keys are
+                // equivalent to *it1_'s, and it2_ the position in it.
+                I2 first2_, last2_, it2_;
+                S2 end2_;
+
+                // Find the next pair of elements with equivalent keys, and the run of
+                // them in the second range.
+                void satisfy()
+                {
+                    while(it1_ != end1_ && first2_ != end2_)
+                    {
+                        if(pred_(proj1_(*it1_), proj2_(*first2_)))
+                            it1_ = aux::gallop_lower_bound(std::move(it1_), end1_,
+                                proj2_(*first2_), pred_, proj1_);
+                        else if(pred_(proj2_(*first2_), proj1_(*it1_)))
+                            first2_ = aux::gallop_lower_bound(std::move(first2_), end2_,
+                                proj1_(*it1_), pred_, proj2_);
+                        else
+                        {
+                            last2_ = aux::gallop_upper_bound(first2_, end2_, proj1_(*it1_),
+                                pred_, proj2_);
+                            it2_ = first2_;
+                            return;
+                        }
+                    }
+                }
+            public:
+                using single_pass = SinglePass<I1>;
+                using value_type = std::pair<range_value_t<base1_t>, range_value_t<base2_t>>;
+                using common_reference =
+                    meta::eval<detail::common_tuple_ref<
+                        detail::remove_rvalue_reference_t<reference_t_> const &,
+                        value_type &>>;
+                cursor() = default;
+                explicit cursor(view_t &rng)
+                  : pred_(rng.pred_), proj1_(rng.proj1_), proj2_(rng.proj2_)
+                  , it1_(begin(rng.rng1_)), end1_(end(rng.rng1_))
+                  , first2_(begin(rng.rng2_)), last2_(first2_), it2_(first2_)
+                  , end2_(end(rng.rng2_))
+                {
+                    satisfy();
+                }
+                reference_t_ current() const
+                {
+                    return reference_t_{*it1_, *it2_};
+                }
+                void next()
+                {
+                    if(++it2_ != last2_)
+                        return;
+                    // The first range is sorted, so the next element's key is equivalent
+                    // to this run's unless it's ordered after it. If it's equivalent,
+                    // replay the run.
+                    ++it1_;
+                    if(it1_ != end1_ && !pred_(proj2_(*first2_), proj1_(*it1_)))
+                    {
+                        it2_ = first2_;
+                        return;
+                    }
+                    first2_ = last2_;
+                    satisfy();
+                }
+                bool done() const
+                {
+                    return it1_ == end1_ || first2_ == end2_;
+                }
+                CONCEPT_REQUIRES(ForwardIterator<I1>())
+                bool equal(cursor const &that) const
+                {
+                    return it1_ == that.it1_ && it2_ == that.it2_;
+                }
+            };
+            using const_iterable_t =
+                meta::and_<Iterable<base1_t const>, Iterable<base2_t const>>;
+            CONCEPT_REQUIRES(!const_iterable_t())
+            cursor<false> begin_cursor()
+            {
+                return cursor<false>{*this};
+            }
+            CONCEPT_REQUIRES(const_iterable_t())
+            cursor<true> begin_cursor() const
+            {
+                return cursor<true>{*this};
+            }
+        public:
+            merge_join_view() = default;
+            merge_join_view(Rng1 && rng1, Rng2 && rng2, C pred, P1 proj1, P2 proj2)
+              : rng1_(view::all(std::forward<Rng1>(rng1)))
+              , rng2_(view::all(std::forward<Rng2>(rng2)))
+              , pred_(invokable(std::move(pred)))
+              , proj1_(invokable(std::move(proj1)))
+              , proj2_(invokable(std::move(proj2)))
+            {}
+        };
+
+        namespace view
+        {
+            struct merge_join_fn
+            {
+            private:
+                friend view_access;
+                template<typename Rng2, typename...Rest,
+                    CONCEPT_REQUIRES_(Iterable<Rng2>() && !meta::or_<Iterable<Rest>...>())>
+                static auto bind(merge_join_fn merge_join, Rng2 && rng2, Rest &&...rest)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(merge_join, std::placeholders::_1,
+                        all(std::forward<Rng2>(rng2)), protect(std::forward<Rest>(rest))...))
+                )
+            public:
+                template<typename Rng1, typename Rng2, typename C, typename P1, typename P2,
+                    typename I1 = range_iterator_t<Rng1>, typename I2 = range_iterator_t<Rng2>>
+                using Concept = meta::and_<
+                    InputIterable<Rng1>,
+                    ForwardIterable<Rng2>,
+                    Comparable<I1, I2, C, P1, P2>,
+                    Comparable<I2, I1, C, P2, P1>>;
+
+                template<typename Rng1, typename Rng2, typename C = ordered_less,
+                    typename P1 = ident, typename P2 = ident,
+                    CONCEPT_REQUIRES_(Concept<Rng1, Rng2, C, P1, P2>())>
+                merge_join_view<Rng1, Rng2, C, P1, P2>
+                operator()(Rng1 && rng1, Rng2 && rng2, C pred = C{}, P1 proj1 = P1{},
+                    P2 proj2 = P2{}) const
+                {
+                    return {std::forward<Rng1>(rng1), std::forward<Rng2>(rng2), std::move(pred),
+                        std::move(proj1), std::move(proj2)};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng1, typename Rng2, typename C = ordered_less,
+                    typename P1 = ident, typename P2 = ident,
+                    CONCEPT_REQUIRES_(!Concept<Rng1, Rng2, C, P1, P2>() &&
+                        Iterable<Rng1>() && Iterable<Rng2>())>
+                void operator()(Rng1 &&, Rng2 &&, C = C{}, P1 = P1{}, P2 = P2{}) const
+                {
+                    CONCEPT_ASSERT_MSG(InputIterable<Rng1>(),
+                        "The first range passed to view::merge_join must be a model of the "
+                        "InputIterable concept.");
+                    CONCEPT_ASSERT_MSG(ForwardIterable<Rng2>(),
+                        "The second range passed to view::merge_join must be a model of the "
+                        "ForwardIterable concept, so that runs of equal keys can be replayed.");
+                    CONCEPT_ASSERT_MSG(Comparable<range_iterator_t<Rng1>,
+                            range_iterator_t<Rng2>, C, P1, P2>(),
+                        "The comparison passed to view::merge_join must be callable with "
+                        "the projected elements of both ranges, in either order.");
+                }
+            #endif
+            };
+
+            /// \relates merge_join_fn
+            /// \ingroup group-views
+            constexpr view<merge_join_fn> merge_join{};
+        }
+        /// @}
+    }
+}
+
+#endif
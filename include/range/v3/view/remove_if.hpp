@@ -17,6 +17,7 @@
 #include <utility>
 #include <type_traits>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/for_each_until.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_adaptor.hpp>
@@ -26,7 +27,9 @@
 #include <range/v3/utility/optional.hpp>
 #include <range/v3/utility/invokable.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/compressed_pair.hpp>
 #include <range/v3/algorithm/find_if_not.hpp>
+#include <range/v3/algorithm/remove_copy_if.hpp>
 #include <range/v3/view/view.hpp>
 
 namespace ranges
@@ -44,40 +47,45 @@ namespace ranges
             semiregular_invokable_t<Pred> pred_;
             optional<range_iterator_t<Rng>> begin_;
 
+            // The iterators carry the base range's end and the predicate rather than a
+            // pointer back to the view, so that the optimizer can keep them in registers
+            // instead of reloading them after every store it can't prove doesn't alias
+            // the view. An empty, trivial predicate takes no space.
             struct adaptor
               : adaptor_base
             {
             private:
-                remove_if_view *rng_;
+                using pred_ref_t = semiregular_invokable_ref_t<Pred>;
+                compressed_pair<range_sentinel_t<Rng>, pred_ref_t> end_pred_;
                 using adaptor_base::advance;
-                void satisfy(range_iterator_t<Rng> &it) const
+                void satisfy(range_iterator_t<Rng> &it)
                 {
-                    it = find_if_not(std::move(it), ranges::end(rng_->mutable_base()),
-                        std::ref(rng_->pred_));
+                    it = find_if_not(std::move(it), end_pred_.first,
+                        std::ref(end_pred_.second));
                 }
             public:
                 adaptor() = default;
                 adaptor(remove_if_view &rng)
-                  : rng_(&rng)
+                  : end_pred_{ranges::end(rng.mutable_base()), pred_ref_t(rng.pred_)}
                 {}
-                range_iterator_t<Rng> begin(remove_if_view &) const
+                range_iterator_t<Rng> begin(remove_if_view &rng)
                 {
-                    auto &beg = rng_->begin_;
+                    auto &beg = rng.begin_;
                     if(!beg)
                     {
-                        beg = ranges::begin(rng_->mutable_base());
+                        beg = ranges::begin(rng.mutable_base());
                         this->satisfy(*beg);
                     }
                     return *beg;
                 }
-                void next(range_iterator_t<Rng> &it) const
+                void next(range_iterator_t<Rng> &it)
                 {
                     this->satisfy(++it);
                 }
                 CONCEPT_REQUIRES(BidirectionalIterable<Rng>())
-                void prev(range_iterator_t<Rng> &it) const
+                void prev(range_iterator_t<Rng> &it)
                 {
-                    auto &&pred = rng_->pred_;
+                    auto &&pred = end_pred_.second;
                     do --it; while(pred(*it));
                 }
             };
@@ -85,12 +93,39 @@ namespace ranges
             {
                 return {*this};
             }
-            // TODO: if end is a sentinel, it holds an unnecessary pointer back to
-            // this range.
             adaptor end_adaptor()
             {
                 return {*this};
             }
+
+            // Push the base range's elements that don't satisfy the predicate.
+            template<typename Sink>
+            struct sink_adaptor
+            {
+                semiregular_invokable_t<Pred> &pred_;
+                Sink &sink_;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    return pred_(t) || sink_(std::forward<T>(t));
+                }
+            };
+            template<typename Sink>
+            bool for_each_until(Sink &sink)
+            {
+                return ranges::for_each_until(this->base(), sink_adaptor<Sink>{pred_, sink});
+            }
+            // Copy the base range's elements that don't satisfy the predicate in one
+            // loop, which for contiguous ranges of numbers doesn't branch on each
+            // element; see remove_copy_if.
+            template<typename O>
+            auto copy(O out) ->
+                decltype(ranges::remove_copy_if(std::declval<base_range_t<remove_if_view> &>(),
+                    std::move(out), std::ref(pred_)).second)
+            {
+                return ranges::remove_copy_if(this->base(), std::move(out),
+                    std::ref(pred_)).second;
+            }
         public:
             remove_if_view() = default;
             remove_if_view(remove_if_view &&that)
@@ -70,6 +70,14 @@ namespace ranges
             {
                 return {value_, n_};
             }
+            template<typename Fun>
+            bool for_each_until(Fun &fun) const
+            {
+                for(std::size_t n = n_; n != 0; --n)
+                    if(!fun(Val(value_)))
+                        return false;
+                return true;
+            }
         public:
             repeat_n_view() = default;
             constexpr repeat_n_view(Val value, std::size_t n)
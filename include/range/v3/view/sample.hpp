@@ -0,0 +1,170 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_SAMPLE_HPP
+#define RANGES_V3_VIEW_SAMPLE_HPP
+
+#include <random>
+#include <utility>
+#include <functional>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/distance.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/utility/random.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/algorithm/shuffle.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// A random sample of `n` elements of a range, in their original order, drawn
+        /// lazily by selection sampling (Knuth's Algorithm S): with `k` elements still to
+        /// choose from the remaining `r`, the next element is chosen with probability
+        /// `k/r`. Every subset of size `n` is equally likely. Each traversal draws a new
+        /// sample from the generator, which is held by reference, so the view is
+        /// single-pass.
+        template<typename Rng, typename Gen>
+        struct sample_view
+          : range_facade<sample_view<Rng, Gen>>
+        {
+        private:
+            friend range_access;
+            using difference_type_ = range_difference_t<Rng>;
+            Rng rng_;
+            difference_type_ n_;
+            Gen *gen_;
+
+            struct cursor
+            {
+            private:
+                range_iterator_t<Rng> it_;
+                difference_type_ size_;
+                difference_type_ n_;
+                Gen *gen_;
+                // Skip ahead to the next element that is chosen.
+                void satisfy()
+                {
+                    auto rand = detail::make_bounded_random(*gen_);
+                    while(n_ < size_ && difference_type_(rand(std::uint64_t(size_))) >= n_)
+                    {
+                        ++it_;
+                        --size_;
+                    }
+                }
+            public:
+                using single_pass = std::true_type;
+                cursor() = default;
+                cursor(range_iterator_t<Rng> it, difference_type_ size, difference_type_ n,
+                    Gen &gen)
+                  : it_(std::move(it)), size_(size), n_(n < size ? n : size), gen_(&gen)
+                {
+                    if(0 < n_)
+                        satisfy();
+                }
+                auto current() const -> decltype(*it_)
+                {
+                    return *it_;
+                }
+                void next()
+                {
+                    ++it_;
+                    --size_;
+                    if(0 < --n_)
+                        satisfy();
+                }
+                bool done() const
+                {
+                    return 0 == n_;
+                }
+            };
+            cursor begin_cursor()
+            {
+                return {begin(rng_), distance(rng_), n_, *gen_};
+            }
+        public:
+            sample_view() = default;
+            sample_view(Rng rng, difference_type_ n, Gen &gen)
+              : rng_(std::move(rng)), n_(n), gen_(&gen)
+            {
+                RANGES_ASSERT(0 <= n_);
+            }
+        };
+
+        namespace view
+        {
+            struct sample_fn
+            {
+            private:
+                friend view_access;
+                template<typename Size, typename Gen,
+                    CONCEPT_REQUIRES_(Integral<Size>() && UniformRandomNumberGenerator<Gen>())>
+                static auto bind(sample_fn sample, Size n, Gen &gen)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(sample, std::placeholders::_1, n, std::ref(gen)))
+                )
+                template<typename Size, CONCEPT_REQUIRES_(Integral<Size>())>
+                static auto bind(sample_fn sample, Size n)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(sample, std::placeholders::_1, n))
+                )
+            public:
+                template<typename Rng, typename Gen,
+                    CONCEPT_REQUIRES_(ForwardIterable<Rng>() &&
+                        UniformRandomNumberGenerator<Gen>())>
+                sample_view<all_t<Rng>, Gen>
+                operator()(Rng && rng, range_difference_t<Rng> n, Gen &gen) const
+                {
+                    return {all(std::forward<Rng>(rng)), n, gen};
+                }
+                /// Uses a per-thread generator seeded from `std::random_device`.
+                template<typename Rng, CONCEPT_REQUIRES_(ForwardIterable<Rng>())>
+                sample_view<all_t<Rng>, std::mt19937_64>
+                operator()(Rng && rng, range_difference_t<Rng> n) const
+                {
+                    return {all(std::forward<Rng>(rng)), n, detail::random_engine_()};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename T, typename...Gen,
+                    CONCEPT_REQUIRES_(!ForwardIterable<Rng>())>
+                void operator()(Rng &&, T &&, Gen &&...) const
+                {
+                    CONCEPT_ASSERT_MSG(ForwardIterable<Rng>(),
+                        "The object to be operated on by view::sample should be a model of the "
+                        "ForwardIterable concept, so that its size can be known before the "
+                        "sample is drawn.");
+                }
+            #endif
+            };
+
+            /// \relates sample_fn
+            /// \ingroup group-views
+            constexpr view<sample_fn> sample{};
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -0,0 +1,424 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_SET_ALGORITHM_HPP
+#define RANGES_V3_VIEW_SET_ALGORITHM_HPP
+
+#include <utility>
+#include <functional>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/invokable.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/algorithm/aux_/gallop_lower_bound.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // State shared by all the set cursors: the two positions, their ends, and
+            // the comparison and projections. Like the other adaptors' cursors, they
+            // refer to the view's function objects when those aren't semiregular, as
+            // lambdas aren't, so they mustn't outlive the view.
+            template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+            struct set_cursor_base
+            {
+            protected:
+                using I1 = range_iterator_t<Rng1 const>;
+                using S1 = range_sentinel_t<Rng1 const>;
+                using I2 = range_iterator_t<Rng2 const>;
+                using S2 = range_sentinel_t<Rng2 const>;
+                semiregular_invokable_ref_t<C, true> pred_;
+                semiregular_invokable_ref_t<P1, true> proj1_;
+                semiregular_invokable_ref_t<P2, true> proj2_;
+                I1 it1_;
+                S1 end1_;
+                I2 it2_;
+                S2 end2_;
+
+                // Is *it1_ ordered before *it2_?
+                bool lt12() const
+                {
+                    return pred_(proj1_(*it1_), proj2_(*it2_));
+                }
+                // Is *it2_ ordered before *it1_?
+                bool lt21() const
+                {
+                    return pred_(proj2_(*it2_), proj1_(*it1_));
+                }
+                // Skip the elements of the first range that are ordered before *it2_.
+                // Galloping makes this cheap when the first range is much longer.
+                void gallop1()
+                {
+                    it1_ = aux::gallop_lower_bound(std::move(it1_), end1_, proj2_(*it2_), pred_,
+                        proj1_);
+                }
+                // Skip the elements of the second range that are ordered before *it1_.
+                void gallop2()
+                {
+                    it2_ = aux::gallop_lower_bound(std::move(it2_), end2_, proj1_(*it1_), pred_,
+                        proj2_);
+                }
+            public:
+                using single_pass = meta::or_<SinglePass<I1>, SinglePass<I2>>;
+                set_cursor_base() = default;
+                set_cursor_base(semiregular_invokable_ref_t<C, true> pred,
+                    semiregular_invokable_ref_t<P1, true> proj1,
+                    semiregular_invokable_ref_t<P2, true> proj2,
+                    I1 it1, S1 end1, I2 it2, S2 end2)
+                  : pred_(std::move(pred)), proj1_(std::move(proj1)), proj2_(std::move(proj2))
+                  , it1_(std::move(it1)), end1_(std::move(end1))
+                  , it2_(std::move(it2)), end2_(std::move(end2))
+                {}
+                CONCEPT_REQUIRES(ForwardIterator<I1>() && ForwardIterator<I2>())
+                bool equal(set_cursor_base const &that) const
+                {
+                    return it1_ == that.it1_ && it2_ == that.it2_;
+                }
+            };
+
+            template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+            struct set_intersection_cursor
+              : set_cursor_base<Rng1, Rng2, C, P1, P2>
+            {
+            private:
+                using base_t = set_cursor_base<Rng1, Rng2, C, P1, P2>;
+                void satisfy()
+                {
+                    while(this->it1_ != this->end1_ && this->it2_ != this->end2_)
+                    {
+                        if(this->lt12())
+                            this->gallop1();
+                        else if(this->lt21())
+                            this->gallop2();
+                        else
+                            break;
+                    }
+                }
+            public:
+                set_intersection_cursor() = default;
+                explicit set_intersection_cursor(set_cursor_base<Rng1, Rng2, C, P1, P2> base)
+                  : base_t(std::move(base))
+                {
+                    this->satisfy();
+                }
+                range_reference_t<Rng1 const> current() const
+                {
+                    return *this->it1_;
+                }
+                void next()
+                {
+                    ++this->it1_;
+                    ++this->it2_;
+                    this->satisfy();
+                }
+                bool done() const
+                {
+                    return this->it1_ == this->end1_ || this->it2_ == this->end2_;
+                }
+            };
+
+            template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+            struct set_difference_cursor
+              : set_cursor_base<Rng1, Rng2, C, P1, P2>
+            {
+            private:
+                using base_t = set_cursor_base<Rng1, Rng2, C, P1, P2>;
+                void satisfy()
+                {
+                    while(this->it1_ != this->end1_ && this->it2_ != this->end2_)
+                    {
+                        if(this->lt12())
+                            break;
+                        if(this->lt21())
+                            this->gallop2();
+                        else
+                        {
+                            ++this->it1_;
+                            ++this->it2_;
+                        }
+                    }
+                }
+            public:
+                set_difference_cursor() = default;
+                explicit set_difference_cursor(set_cursor_base<Rng1, Rng2, C, P1, P2> base)
+                  : base_t(std::move(base))
+                {
+                    this->satisfy();
+                }
+                range_reference_t<Rng1 const> current() const
+                {
+                    return *this->it1_;
+                }
+                void next()
+                {
+                    ++this->it1_;
+                    this->satisfy();
+                }
+                bool done() const
+                {
+                    return this->it1_ == this->end1_;
+                }
+            };
+
+            // Common machinery for the set operations that can yield elements from
+            // either range.
+            template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+            struct set_either_cursor_base
+              : set_cursor_base<Rng1, Rng2, C, P1, P2>
+            {
+            protected:
+                enum which_t { first_, second_, both_ };
+                which_t which_;
+            public:
+                using reference =
+                    common_reference_t<range_reference_t<Rng1 const>,
+                        range_reference_t<Rng2 const>>;
+                set_either_cursor_base() = default;
+                explicit set_either_cursor_base(set_cursor_base<Rng1, Rng2, C, P1, P2> base)
+                  : set_cursor_base<Rng1, Rng2, C, P1, P2>(std::move(base))
+                {}
+                reference current() const
+                {
+                    if(which_ == second_)
+                        return *this->it2_;
+                    return *this->it1_;
+                }
+                bool done() const
+                {
+                    return this->it1_ == this->end1_ && this->it2_ == this->end2_;
+                }
+            };
+
+            template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+            struct set_union_cursor
+              : set_either_cursor_base<Rng1, Rng2, C, P1, P2>
+            {
+            private:
+                using base_t = set_either_cursor_base<Rng1, Rng2, C, P1, P2>;
+                void satisfy()
+                {
+                    if(this->it1_ == this->end1_)
+                        this->which_ = base_t::second_;
+                    else if(this->it2_ == this->end2_)
+                        this->which_ = base_t::first_;
+                    else if(this->lt21())
+                        this->which_ = base_t::second_;
+                    else if(this->lt12())
+                        this->which_ = base_t::first_;
+                    else
+                        this->which_ = base_t::both_;
+                }
+            public:
+                set_union_cursor() = default;
+                explicit set_union_cursor(set_cursor_base<Rng1, Rng2, C, P1, P2> base)
+                  : base_t(std::move(base))
+                {
+                    this->satisfy();
+                }
+                void next()
+                {
+                    if(this->which_ != base_t::second_)
+                        ++this->it1_;
+                    if(this->which_ != base_t::first_)
+                        ++this->it2_;
+                    this->satisfy();
+                }
+            };
+
+            template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+            struct set_symmetric_difference_cursor
+              : set_either_cursor_base<Rng1, Rng2, C, P1, P2>
+            {
+            private:
+                using base_t = set_either_cursor_base<Rng1, Rng2, C, P1, P2>;
+                void satisfy()
+                {
+                    while(true)
+                    {
+                        if(this->it1_ == this->end1_)
+                        {
+                            this->which_ = base_t::second_;
+                            return;
+                        }
+                        if(this->it2_ == this->end2_ || this->lt12())
+                        {
+                            this->which_ = base_t::first_;
+                            return;
+                        }
+                        if(this->lt21())
+                        {
+                            this->which_ = base_t::second_;
+                            return;
+                        }
+                        ++this->it1_;
+                        ++this->it2_;
+                    }
+                }
+            public:
+                set_symmetric_difference_cursor() = default;
+                explicit set_symmetric_difference_cursor(set_cursor_base<Rng1, Rng2, C, P1, P2> base)
+                  : base_t(std::move(base))
+                {
+                    this->satisfy();
+                }
+                void next()
+                {
+                    if(this->which_ == base_t::first_)
+                        ++this->it1_;
+                    else
+                        ++this->it2_;
+                    this->satisfy();
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-views
+        /// @{
+
+        /// A lazy view of the result of a set operation on two sorted ranges. \c Cursor
+        /// decides which elements survive.
+        template<typename Rng1, typename Rng2, typename C, typename P1, typename P2,
+            template<typename, typename, typename, typename, typename> class Cursor>
+        struct set_algorithm_view
+          : range_facade<set_algorithm_view<Rng1, Rng2, C, P1, P2, Cursor>>
+        {
+        private:
+            friend range_access;
+            using base1_t = view::all_t<Rng1>;
+            using base2_t = view::all_t<Rng2>;
+            base1_t rng1_;
+            base2_t rng2_;
+            semiregular_invokable_t<C> pred_;
+            semiregular_invokable_t<P1> proj1_;
+            semiregular_invokable_t<P2> proj2_;
+
+            Cursor<base1_t, base2_t, C, P1, P2> begin_cursor() const
+            {
+                return Cursor<base1_t, base2_t, C, P1, P2>{
+                    detail::set_cursor_base<base1_t, base2_t, C, P1, P2>{pred_, proj1_, proj2_,
+                        begin(rng1_), end(rng1_), begin(rng2_), end(rng2_)}};
+            }
+        public:
+            set_algorithm_view() = default;
+            set_algorithm_view(Rng1 && rng1, Rng2 && rng2, C pred, P1 proj1, P2 proj2)
+              : rng1_(view::all(std::forward<Rng1>(rng1)))
+              , rng2_(view::all(std::forward<Rng2>(rng2)))
+              , pred_(invokable(std::move(pred)))
+              , proj1_(invokable(std::move(proj1)))
+              , proj2_(invokable(std::move(proj2)))
+            {}
+        };
+
+        template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+        using set_union_view =
+            set_algorithm_view<Rng1, Rng2, C, P1, P2, detail::set_union_cursor>;
+
+        template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+        using set_intersection_view =
+            set_algorithm_view<Rng1, Rng2, C, P1, P2, detail::set_intersection_cursor>;
+
+        template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+        using set_difference_view =
+            set_algorithm_view<Rng1, Rng2, C, P1, P2, detail::set_difference_cursor>;
+
+        template<typename Rng1, typename Rng2, typename C, typename P1, typename P2>
+        using set_symmetric_difference_view =
+            set_algorithm_view<Rng1, Rng2, C, P1, P2, detail::set_symmetric_difference_cursor>;
+
+        namespace view
+        {
+            template<template<typename, typename, typename, typename, typename> class Cursor>
+            struct set_algorithm_fn
+            {
+            private:
+                friend view_access;
+                template<typename Rng2, typename...Rest,
+                    CONCEPT_REQUIRES_(Iterable<Rng2>() && !meta::or_<Iterable<Rest>...>())>
+                static auto bind(set_algorithm_fn set_algorithm, Rng2 && rng2, Rest &&...rest)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(set_algorithm, std::placeholders::_1,
+                        all(std::forward<Rng2>(rng2)), protect(std::forward<Rest>(rest))...))
+                )
+            public:
+                template<typename Rng1, typename Rng2, typename C, typename P1, typename P2,
+                    typename I1 = range_iterator_t<Rng1>, typename I2 = range_iterator_t<Rng2>>
+                using Concept = meta::and_<
+                    InputIterable<Rng1>,
+                    InputIterable<Rng2>,
+                    Comparable<I1, I2, C, P1, P2>,
+                    Comparable<I2, I1, C, P2, P1>>;
+
+                template<typename Rng1, typename Rng2, typename C = ordered_less,
+                    typename P1 = ident, typename P2 = ident,
+                    CONCEPT_REQUIRES_(Concept<Rng1, Rng2, C, P1, P2>())>
+                set_algorithm_view<Rng1, Rng2, C, P1, P2, Cursor>
+                operator()(Rng1 && rng1, Rng2 && rng2, C pred = C{}, P1 proj1 = P1{},
+                    P2 proj2 = P2{}) const
+                {
+                    return {std::forward<Rng1>(rng1), std::forward<Rng2>(rng2), std::move(pred),
+                        std::move(proj1), std::move(proj2)};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng1, typename Rng2, typename C = ordered_less,
+                    typename P1 = ident, typename P2 = ident,
+                    CONCEPT_REQUIRES_(!Concept<Rng1, Rng2, C, P1, P2>() &&
+                        Iterable<Rng1>() && Iterable<Rng2>())>
+                void operator()(Rng1 &&, Rng2 &&, C = C{}, P1 = P1{}, P2 = P2{}) const
+                {
+                    CONCEPT_ASSERT_MSG(InputIterable<Rng1>() && InputIterable<Rng2>(),
+                        "Both of the ranges passed to a set operation view must be models of "
+                        "the InputIterable concept.");
+                    CONCEPT_ASSERT_MSG(Comparable<range_iterator_t<Rng1>,
+                            range_iterator_t<Rng2>, C, P1, P2>(),
+                        "The comparison passed to a set operation view must be callable with "
+                        "the projected elements of both ranges, in either order.");
+                }
+            #endif
+            };
+
+            /// \relates set_algorithm_fn
+            /// \ingroup group-views
+            constexpr view<set_algorithm_fn<detail::set_union_cursor>> set_union{};
+
+            /// \relates set_algorithm_fn
+            /// \ingroup group-views
+            constexpr view<set_algorithm_fn<detail::set_intersection_cursor>> set_intersection{};
+
+            /// \relates set_algorithm_fn
+            /// \ingroup group-views
+            constexpr view<set_algorithm_fn<detail::set_difference_cursor>> set_difference{};
+
+            /// \relates set_algorithm_fn
+            /// \ingroup group-views
+            constexpr view<set_algorithm_fn<detail::set_symmetric_difference_cursor>>
+                set_symmetric_difference{};
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -82,6 +82,11 @@ namespace ranges
             {
                 return {value_};
             }
+            template<typename Fun>
+            bool for_each_until(Fun &fun) const
+            {
+                return fun(Val(value_));
+            }
         public:
             single_view() = default;
             constexpr explicit single_view(Val value)
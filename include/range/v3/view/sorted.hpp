@@ -0,0 +1,442 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_SORTED_HPP
+#define RANGES_V3_VIEW_SORTED_HPP
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/heap_algorithm.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/invokable.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            struct file_closer
+            {
+                void operator()(std::FILE *file) const
+                {
+                    if(file)
+                        std::fclose(file);
+                }
+            };
+
+            // A sorted run of a sorted_view. A run that was spilled lives in a temporary
+            // file and is read back a block at a time; one that wasn't is a single block.
+            // Only trivial types are spilled, as raw bytes. Copies of a spilled run share
+            // the file but each reads it from its own position.
+            template<typename V>
+            struct sorted_run
+            {
+            private:
+                std::shared_ptr<std::FILE> file_;
+                std::size_t size_ = 0;
+                std::size_t read_ = 0;
+                std::size_t block_size_ = 0;
+                std::vector<V> block_;
+                std::size_t pos_ = 0;
+
+                void fill(std::true_type)
+                {
+                    std::size_t const n = (std::min)(size_ - read_, block_size_);
+                    block_.resize(n);
+                    if(n != 0 &&
+                        (std::fseek(file_.get(), static_cast<long>(read_ * sizeof(V)),
+                            SEEK_SET) != 0 ||
+                         std::fread(block_.data(), sizeof(V), n, file_.get()) != n))
+                        throw std::runtime_error(
+                            "view::sorted: cannot read a spilled run");
+                    read_ += n;
+                    pos_ = 0;
+                }
+                void fill(std::false_type)
+                {}
+            public:
+                sorted_run() = default;
+                explicit sorted_run(std::vector<V> elems)
+                  : block_(std::move(elems))
+                {}
+                // An empty run backed by a new temporary file, to be appended to.
+                static sorted_run spill()
+                {
+                    sorted_run run;
+                    run.file_.reset(std::tmpfile(), file_closer{});
+                    if(!run.file_)
+                        throw std::runtime_error(
+                            "view::sorted: cannot create a temporary file");
+                    return run;
+                }
+                void append(V const *elems, std::size_t n)
+                {
+                    RANGES_ASSERT(file_);
+                    if(n != 0 && std::fwrite(elems, sizeof(V), n, file_.get()) != n)
+                        throw std::runtime_error("view::sorted: cannot spill a run");
+                    size_ += n;
+                }
+                // Start reading the run over, `block_size` elements at a time.
+                void rewind(std::size_t block_size)
+                {
+                    pos_ = 0;
+                    if(file_)
+                    {
+                        read_ = 0;
+                        block_size_ = block_size;
+                        fill(std::is_trivial<V>{});
+                    }
+                }
+                bool done() const
+                {
+                    return pos_ == block_.size();
+                }
+                V &head()
+                {
+                    RANGES_ASSERT(!done());
+                    return block_[pos_];
+                }
+                void next()
+                {
+                    RANGES_ASSERT(!done());
+                    if(++pos_ == block_.size() && file_ && read_ != size_)
+                        fill(std::is_trivial<V>{});
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-views
+        /// @{
+
+        /// The elements of a range sorted by `pred` and `proj`, like GNU sort: the
+        /// first call to `begin()` reads the range, which may be single-pass, into
+        /// runs of at most `max_bytes` worth of elements and sorts each. If there is
+        /// more than one, each is spilled to a temporary file when full, and the
+        /// runs are then merged lazily, so at most about `max_bytes` of elements are
+        /// in memory however long the range is. Spilled runs are merged as they are
+        /// written, like a counter in base `max_fan_in`: the runs read from the range
+        /// are of level 0, and `max_fan_in` runs of one level are merged into a run of
+        /// the next. So each element is written O(log(runs) / log(max_fan_in)) times,
+        /// and fewer than `max_fan_in` runs of each level are open at once.
+        ///
+        /// Elements are spilled as raw bytes, so only ranges of trivial types are.
+        /// Ranges of other types, such as `std::string` or `std::pair`, are read into
+        /// memory whole and sorted as a single run, and `view::sorted` rejects a
+        /// memory budget for them. The order of equal elements is unspecified.
+        ///
+        /// The merge runs in the view, so the view is single-pass, and `begin()` starts
+        /// the merge over. A copy of the view merges on its own: copies share the
+        /// temporary files, but each reads them from its own positions. Throws
+        /// `std::runtime_error` if a temporary file can't be created, written or read.
+        template<typename Rng, typename C, typename P>
+        struct sorted_view
+          : range_facade<sorted_view<Rng, C, P>>
+        {
+        private:
+            friend range_access;
+            using value_t = range_value_t<Rng>;
+            using run_t = detail::sorted_run<value_t>;
+            // The least number of elements read from a spilled run at once
+            static constexpr std::size_t min_block = 4096 / sizeof(value_t) + 1;
+            view::all_t<Rng> rng_;
+            std::size_t run_size_;
+            semiregular_invokable_t<C> pred_;
+            semiregular_invokable_t<P> proj_;
+            std::vector<run_t> runs_;
+            // The level of each spilled run, which never increases along runs_
+            std::vector<std::size_t> levels_;
+            std::vector<std::size_t> heap_;
+            std::size_t spilled_bytes_ = 0;
+            bool built_ = false;
+
+            // Orders run indices by their heads, the least on top of the heap.
+            struct head_greater
+            {
+                sorted_view *rng_;
+                std::vector<run_t> *runs_;
+                bool operator()(std::size_t a, std::size_t b) const
+                {
+                    return rng_->pred_(rng_->proj_((*runs_)[b].head()),
+                        rng_->proj_((*runs_)[a].head()));
+                }
+            };
+
+            void start_merge(std::vector<run_t> &runs, std::vector<std::size_t> &heap)
+            {
+                std::size_t const block =
+                    (std::max)(run_size_ / (runs.size() + 1), min_block);
+                heap.clear();
+                for(std::size_t i = 0; i < runs.size(); ++i)
+                {
+                    runs[i].rewind(block);
+                    if(!runs[i].done())
+                        heap.push_back(i);
+                }
+                make_heap(heap, head_greater{this, &runs});
+            }
+            // Step past the least head.
+            void pop_merge(std::vector<run_t> &runs, std::vector<std::size_t> &heap)
+            {
+                head_greater greater{this, &runs};
+                runs[heap.front()].next();
+                if(runs[heap.front()].done())
+                {
+                    pop_heap(heap, greater);
+                    heap.pop_back();
+                }
+                else
+                    detail::sift_down_n(heap.begin(),
+                        static_cast<std::ptrdiff_t>(heap.size()), heap.begin(), greater);
+            }
+
+            void append(run_t &run, value_t const *elems, std::size_t n)
+            {
+                run.append(elems, n);
+                spilled_bytes_ += n * sizeof(value_t);
+            }
+            // Merge the last max_fan_in spilled runs into one of the given level.
+            void merge_last(std::size_t level)
+            {
+                auto const first = runs_.end() - static_cast<std::ptrdiff_t>(max_fan_in);
+                std::vector<run_t> group(std::make_move_iterator(first),
+                    std::make_move_iterator(runs_.end()));
+                runs_.erase(first, runs_.end());
+                levels_.resize(runs_.size());
+                std::vector<std::size_t> heap;
+                start_merge(group, heap);
+                run_t merged = run_t::spill();
+                std::vector<value_t> out;
+                std::size_t const block =
+                    (std::max)(run_size_ / (max_fan_in + 1), min_block);
+                out.reserve(block);
+                for(; !heap.empty(); pop_merge(group, heap))
+                {
+                    out.push_back(group[heap.front()].head());
+                    if(out.size() == block)
+                    {
+                        append(merged, out.data(), out.size());
+                        out.clear();
+                    }
+                }
+                append(merged, out.data(), out.size());
+                runs_.push_back(std::move(merged));
+                levels_.push_back(level);
+            }
+            void spill(std::vector<value_t> &run, std::true_type)
+            {
+                ranges::sort(run, pred_, proj_);
+                runs_.push_back(run_t::spill());
+                levels_.push_back(0);
+                append(runs_.back(), run.data(), run.size());
+                run.clear();
+                // Carry: while the last max_fan_in runs are all of one level, merge them.
+                while(runs_.size() >= max_fan_in &&
+                    levels_[runs_.size() - max_fan_in] == levels_.back())
+                {
+                    // Give the merge the run's memory.
+                    std::vector<value_t>().swap(run);
+                    merge_last(levels_.back() + 1);
+                }
+            }
+            void spill(std::vector<value_t> &, std::false_type)
+            {
+                RANGES_ASSERT(false);
+            }
+            void build()
+            {
+                built_ = true;
+                std::vector<value_t> run;
+                for(auto it = begin(rng_), e = end(rng_); it != e; ++it)
+                {
+                    run.emplace_back(*it);
+                    if(run.size() == run_size_)
+                        spill(run, std::is_trivial<value_t>{});
+                }
+                if(runs_.empty())
+                {
+                    ranges::sort(run, pred_, proj_);
+                    runs_.emplace_back(std::move(run));
+                }
+                else
+                {
+                    if(!run.empty())
+                        spill(run, std::is_trivial<value_t>{});
+                    std::vector<value_t>().swap(run);
+                    // Merge the shortest runs until the rest can be merged at once.
+                    while(runs_.size() > max_fan_in)
+                        merge_last(levels_[runs_.size() - max_fan_in] + 1);
+                }
+            }
+
+            struct cursor
+            {
+            private:
+                sorted_view *rng_;
+            public:
+                using single_pass = std::true_type;
+                cursor() = default;
+                explicit cursor(sorted_view &rng)
+                  : rng_(&rng)
+                {}
+                value_t const &current() const
+                {
+                    return rng_->runs_[rng_->heap_.front()].head();
+                }
+                void next()
+                {
+                    rng_->pop_merge(rng_->runs_, rng_->heap_);
+                }
+                bool done() const
+                {
+                    return rng_->heap_.empty();
+                }
+            };
+            cursor begin_cursor()
+            {
+                if(!built_)
+                    build();
+                start_merge(runs_, heap_);
+                return cursor{*this};
+            }
+        public:
+            /// The most spilled runs merged at once, and so the most temporary files
+            /// open at once
+            static constexpr std::size_t max_fan_in = 64;
+
+            sorted_view() = default;
+            sorted_view(Rng && rng, std::size_t max_bytes, C pred, P proj)
+              : rng_(view::all(std::forward<Rng>(rng)))
+              , run_size_(std::is_trivial<value_t>::value ?
+                    (std::max)(max_bytes / sizeof(value_t), std::size_t{1}) :
+                    static_cast<std::size_t>(-1))
+              , pred_(invokable(std::move(pred)))
+              , proj_(invokable(std::move(proj)))
+            {}
+            /// The number of bytes written to temporary files by the first `begin()`
+            std::size_t spilled_bytes() const
+            {
+                return spilled_bytes_;
+            }
+        };
+
+        template<typename Rng, typename C, typename P>
+        constexpr std::size_t sorted_view<Rng, C, P>::min_block;
+
+        template<typename Rng, typename C, typename P>
+        constexpr std::size_t sorted_view<Rng, C, P>::max_fan_in;
+
+        namespace view
+        {
+            struct sorted_fn
+            {
+            private:
+                friend view_access;
+                template<typename Int, typename C = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(Integral<Int>())>
+                static auto bind(sorted_fn sorted, Int max_bytes, C pred = C{},
+                    P proj = P{})
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(sorted, std::placeholders::_1, max_bytes,
+                        protect(std::move(pred)), protect(std::move(proj))))
+                )
+                template<typename C, typename P = ident,
+                    CONCEPT_REQUIRES_(!Integral<C>() && !Iterable<C>())>
+                static auto bind(sorted_fn sorted, C pred, P proj = P{})
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(sorted, std::placeholders::_1,
+                        protect(std::move(pred)), protect(std::move(proj))))
+                )
+            public:
+                /// The default memory budget, in bytes
+                static constexpr std::size_t default_max_bytes = std::size_t{1} << 26;
+
+                template<typename Rng, typename C, typename P,
+                    typename V = range_value_t<Rng>>
+                using Concept = meta::and_<
+                    InputIterable<Rng>,
+                    Constructible<V, range_reference_t<Rng>>,
+                    Movable<V>,
+                    Sortable<typename std::vector<V>::iterator, C, P>>;
+
+                template<typename Rng, typename C = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(!Integral<C>() && Concept<Rng, C, P>())>
+                sorted_view<Rng, C, P>
+                operator()(Rng && rng, C pred = C{}, P proj = P{}) const
+                {
+                    return {std::forward<Rng>(rng), default_max_bytes, std::move(pred),
+                        std::move(proj)};
+                }
+                template<typename Rng, typename C = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(Concept<Rng, C, P>())>
+                sorted_view<Rng, C, P> operator()(Rng && rng, std::size_t max_bytes,
+                    C pred = C{}, P proj = P{}) const
+                {
+                    static_assert(std::is_trivial<range_value_t<Rng>>::value,
+                        "view::sorted can only spill elements of trivial types, so it reads "
+                        "ranges of other types into memory whole and can't keep to a memory "
+                        "budget. Leave out the max_bytes argument.");
+                    return {std::forward<Rng>(rng), max_bytes, std::move(pred),
+                        std::move(proj)};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename C = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(!Integral<C>() && !Concept<Rng, C, P>())>
+                void operator()(Rng &&, C = C{}, P = P{}) const
+                {
+                    CONCEPT_ASSERT_MSG(InputIterable<Rng>(),
+                        "The object on which view::sorted operates must be a model of the "
+                        "InputIterable concept.");
+                    CONCEPT_ASSERT_MSG(Constructible<range_value_t<Rng>,
+                            range_reference_t<Rng>>() && Movable<range_value_t<Rng>>(),
+                        "view::sorted buffers copies of the elements, so the range's value "
+                        "type must be constructible from its reference type, and movable.");
+                    CONCEPT_ASSERT_MSG(Sortable<
+                            typename std::vector<range_value_t<Rng>>::iterator, C, P>(),
+                        "The comparator passed to view::sorted must accept objects returned "
+                        "by the projection function, or of the range's value type if no "
+                        "projection is specified.");
+                }
+            #endif
+            };
+
+            /// \relates sorted_fn
+            /// \ingroup group-views
+            constexpr view<sorted_fn> sorted{};
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -16,8 +16,10 @@
 
 #include <type_traits>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/for_each_until.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/range_access.hpp>
 #include <range/v3/range_interface.hpp>
 #include <range/v3/range.hpp>
 #include <range/v3/utility/meta.hpp>
@@ -49,8 +51,11 @@ namespace ranges
                 {
                     return {ranges::begin(rng_), n_};
                 }
-                CONCEPT_REQUIRES(Iterable<Rng const>())
-                detail::counted_cursor<range_iterator_t<Rng const>> begin_cursor() const
+                // The return type must depend on the template parameter, or it is
+                // instantiated with the class even when Rng const isn't iterable.
+                template<typename BaseRng = Rng,
+                    CONCEPT_REQUIRES_(Iterable<BaseRng const>())>
+                detail::counted_cursor<range_iterator_t<BaseRng const>> begin_cursor() const
                 {
                     return {ranges::begin(rng_), n_};
                 }
@@ -58,6 +63,26 @@ namespace ranges
                 {
                     return {};
                 }
+
+                // Push the first n_ of the base range's elements, counting them down.
+                template<typename Sink>
+                struct sink_adaptor
+                {
+                    Sink &sink_;
+                    difference_type_ &n_;
+                    template<typename T>
+                    bool operator()(T &&t) const
+                    {
+                        return sink_(std::forward<T>(t)) && --n_ != 0;
+                    }
+                };
+                template<typename Sink>
+                bool for_each_until(Sink &sink)
+                {
+                    difference_type_ n = n_;
+                    return n == 0 ||
+                        ranges::for_each_until(rng_, sink_adaptor<Sink>{sink, n}) || n == 0;
+                }
             public:
                 take_view_() = default;
                 take_view_(Rng && rng, difference_type_ n)
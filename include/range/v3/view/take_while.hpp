@@ -18,6 +18,7 @@
 #include <functional>
 #include <type_traits>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/for_each_until.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_adaptor.hpp>
 #include <range/v3/utility/meta.hpp>
@@ -68,6 +69,31 @@ namespace ranges
             {
                 return {pred_};
             }
+
+            // Push the base range's elements up to the first that fails the predicate,
+            // and note that the view ended there.
+            template<typename Sink>
+            struct sink_adaptor
+            {
+                semiregular_invokable_t<Pred> &pred_;
+                Sink &sink_;
+                bool &ended_;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    if(pred_(t))
+                        return sink_(std::forward<T>(t));
+                    ended_ = true;
+                    return false;
+                }
+            };
+            template<typename Sink>
+            bool for_each_until(Sink &sink)
+            {
+                bool ended = false;
+                return ranges::for_each_until(this->base(),
+                    sink_adaptor<Sink>{pred_, sink, ended}) || ended;
+            }
         public:
             take_while_view() = default;
             take_while_view(Rng && rng, Pred pred)
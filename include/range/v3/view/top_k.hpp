@@ -0,0 +1,205 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_TOP_K_HPP
+#define RANGES_V3_VIEW_TOP_K_HPP
+
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <functional>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/algorithm/heap_algorithm.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/invokable.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// The `k` greatest elements of a range by `proj`, greatest first. The first call
+        /// to `begin()` or `end()` makes one pass over the range, which may be
+        /// single-pass, keeping copies of the greatest `k` elements seen so far in a
+        /// heap with the least of them on top, which each greater element replaces. That
+        /// takes O(N log k) time and O(k) space, where sorting would need all N elements
+        /// at once. Which of equal elements are kept, and in what order, is unspecified.
+        template<typename Rng, typename P>
+        struct top_k_view
+          : range_facade<top_k_view<Rng, P>>
+        {
+        private:
+            friend range_access;
+            using value_t = range_value_t<Rng>;
+            using iterator_t = typename std::vector<value_t>::const_iterator;
+            view::all_t<Rng> rng_;
+            std::size_t k_;
+            semiregular_invokable_t<P> proj_;
+            std::vector<value_t> top_;
+            bool built_ = false;
+
+            void build()
+            {
+                built_ = true;
+                if(k_ == 0)
+                    return;
+                for(auto it = begin(rng_), e = end(rng_); it != e; ++it)
+                {
+                    if(top_.size() < k_)
+                    {
+                        top_.emplace_back(*it);
+                        push_heap(top_, ordered_greater{}, proj_);
+                    }
+                    else if(ordered_greater{}(proj_(*it), proj_(top_.front())))
+                    {
+                        top_.front() = *it;
+                        detail::sift_down_n(top_.begin(), static_cast<std::ptrdiff_t>(k_),
+                            top_.begin(), ordered_greater{}, proj_);
+                    }
+                }
+                sort_heap(top_, ordered_greater{}, proj_);
+            }
+
+            struct cursor
+            {
+            private:
+                iterator_t it_;
+            public:
+                cursor() = default;
+                explicit cursor(iterator_t it)
+                  : it_(it)
+                {}
+                value_t const &current() const
+                {
+                    return *it_;
+                }
+                void next()
+                {
+                    ++it_;
+                }
+                void prev()
+                {
+                    --it_;
+                }
+                void advance(std::ptrdiff_t n)
+                {
+                    it_ += n;
+                }
+                bool equal(cursor const &that) const
+                {
+                    return it_ == that.it_;
+                }
+                std::ptrdiff_t distance_to(cursor const &that) const
+                {
+                    return that.it_ - it_;
+                }
+            };
+            cursor begin_cursor()
+            {
+                if(!built_)
+                    build();
+                return cursor{top_.cbegin()};
+            }
+            cursor end_cursor()
+            {
+                if(!built_)
+                    build();
+                return cursor{top_.cend()};
+            }
+        public:
+            top_k_view() = default;
+            top_k_view(Rng && rng, std::size_t k, P proj)
+              : rng_(view::all(std::forward<Rng>(rng)))
+              , k_(k)
+              , proj_(invokable(std::move(proj)))
+            {}
+            std::size_t size()
+            {
+                if(!built_)
+                    build();
+                return top_.size();
+            }
+        };
+
+        namespace view
+        {
+            struct top_k_fn
+            {
+            private:
+                friend view_access;
+                template<typename Int, typename P = ident, CONCEPT_REQUIRES_(Integral<Int>())>
+                static auto bind(top_k_fn top_k, Int k, P proj = P{})
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(top_k, std::placeholders::_1, k,
+                        protect(std::move(proj))))
+                )
+            public:
+                template<typename Rng, typename P,
+                    typename V = range_value_t<Rng>,
+                    typename X = concepts::Invokable::result_t<P, range_reference_t<Rng>>>
+                using Concept = meta::and_<
+                    InputIterable<Rng>,
+                    Constructible<V, range_reference_t<Rng>>,
+                    Movable<V>,
+                    Invokable<P, range_reference_t<Rng>>,
+                    Invokable<P, V &>,
+                    TotallyOrdered<X>>;
+
+                template<typename Rng, typename P = ident,
+                    CONCEPT_REQUIRES_(Concept<Rng, P>())>
+                top_k_view<Rng, P>
+                operator()(Rng && rng, range_difference_t<Rng> k, P proj = P{}) const
+                {
+                    RANGES_ASSERT(k >= 0);
+                    return {std::forward<Rng>(rng), static_cast<std::size_t>(k),
+                        std::move(proj)};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename T, typename P = ident,
+                    CONCEPT_REQUIRES_(!Concept<Rng, P>())>
+                void operator()(Rng &&, T, P = P{}) const
+                {
+                    CONCEPT_ASSERT_MSG(InputIterable<Rng>(),
+                        "The object on which view::top_k operates must be a model of the "
+                        "InputIterable concept.");
+                    CONCEPT_ASSERT_MSG(Constructible<range_value_t<Rng>,
+                            range_reference_t<Rng>>() && Movable<range_value_t<Rng>>(),
+                        "view::top_k keeps copies of the greatest elements, so the range's "
+                        "value type must be constructible from its reference type, and "
+                        "movable.");
+                    CONCEPT_ASSERT_MSG(Invokable<P, range_reference_t<Rng>>(),
+                        "The projection passed to view::top_k must be callable with the "
+                        "range's reference type.");
+                }
+            #endif
+            };
+
+            /// \relates top_k_fn
+            /// \ingroup group-views
+            constexpr view<top_k_fn> top_k{};
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -19,10 +19,12 @@
 #include <functional>
 #include <type_traits>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/for_each_until.hpp>
 #include <range/v3/size.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_adaptor.hpp>
+#include <range/v3/utility/box.hpp>
 #include <range/v3/utility/meta.hpp>
 #include <range/v3/utility/invokable.hpp>
 #include <range/v3/utility/optional.hpp>
@@ -45,20 +47,25 @@ namespace ranges
             using use_sentinel_t =
                 meta::or_<meta::not_<BoundedIterable<Rng>>, SinglePass<range_iterator_t<Rng>>>;
 
+            // The function is kept in a box so that, when it is empty and trivial, the
+            // adaptor is too, and the iterators are no bigger than the base range's.
             template<bool IsConst>
-            struct adaptor : adaptor_base
+            struct adaptor
+              : adaptor_base
+              , private box<semiregular_invokable_ref_t<Fun, IsConst>, adaptor<IsConst>>
             {
             private:
-                semiregular_invokable_ref_t<Fun, IsConst> fun_;
+                using fun_ref_t = semiregular_invokable_ref_t<Fun, IsConst>;
+                using box_t = box<fun_ref_t, adaptor>;
             public:
                 adaptor() = default;
-                adaptor(semiregular_invokable_ref_t<Fun, IsConst> fun)
-                  : fun_(std::move(fun))
+                adaptor(fun_ref_t fun)
+                  : box_t(std::move(fun))
                 {}
                 auto current(range_iterator_t<Rng> it) const ->
-                    decltype(fun_(*it))
+                    decltype(std::declval<fun_ref_t const &>()(*it))
                 {
-                    return fun_(*it);
+                    return ranges::get<adaptor>(static_cast<box_t const &>(*this))(*it);
                 }
             };
 
@@ -89,6 +96,24 @@ namespace ranges
             {
                 return {fun_};
             }
+
+            // Push the base range's elements through the function.
+            template<typename Sink>
+            struct sink_adaptor
+            {
+                semiregular_invokable_t<Fun> &fun_;
+                Sink &sink_;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    return sink_(fun_(std::forward<T>(t)));
+                }
+            };
+            template<typename Sink>
+            bool for_each_until(Sink &sink)
+            {
+                return ranges::for_each_until(this->base(), sink_adaptor<Sink>{fun_, sink});
+            }
         public:
             transform_view() = default;
             transform_view(Rng && rng, Fun fun)
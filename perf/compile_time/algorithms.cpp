@@ -0,0 +1,43 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Constrained algorithms with comparisons and projections, on a few iterator types.
+
+#include <list>
+#include <string>
+#include <vector>
+#include <utility>
+#include <range/v3/all.hpp>
+
+struct person
+{
+    std::string name;
+    int age;
+};
+
+int main()
+{
+    using namespace ranges;
+    std::vector<person> people = {{"alice", 31}, {"bob", 27}, {"carol", 45}};
+    sort(people, ordered_less{}, &person::age);
+    stable_sort(people, ordered_less{}, &person::name);
+    auto it = lower_bound(people, 30, ordered_less{}, &person::age);
+    auto jt = find_if(people, [](int a) { return a > 40; }, &person::age);
+    std::vector<int> ages(people.size());
+    transform(people, ages.begin(), &person::age);
+    std::list<int> l(ages.begin(), ages.end());
+    auto m = max_element(l);
+    auto u = unique(ages);
+    nth_element(ages, ages.begin() + 1);
+    return int(it - people.begin()) + int(jt - people.begin()) + *m +
+        int(u - ages.begin()) + int(count(ages, 31));
+}
@@ -0,0 +1,105 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compiles each of a set of translation units in turn and reports the wall time,
+// CPU time and peak memory of each compilation:
+//
+//     compile_time <compiler> [<flags>...] -- <source>...
+//
+// The compiler is run once per source, as `<compiler> <flags>... <source>`, so the
+// flags should include -fsyntax-only (or -c -o /dev/null) to measure the front end.
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <iostream>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <sys/types.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+struct measurement
+{
+    bool ok;
+    double wall;   // seconds
+    double cpu;    // seconds, user + system
+    long max_rss;  // kilobytes
+};
+
+double seconds(timeval const &tv)
+{
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+measurement compile(std::vector<char *> argv)
+{
+    argv.push_back(nullptr);
+    auto const start = std::chrono::steady_clock::now();
+    pid_t const pid = fork();
+    if(pid == 0)
+    {
+        execvp(argv[0], argv.data());
+        std::perror(argv[0]);
+        _exit(127);
+    }
+    int status = 0;
+    rusage usage;
+    std::memset(&usage, 0, sizeof(usage));
+    if(pid < 0 || wait4(pid, &status, 0, &usage) != pid)
+        return {false, 0, 0, 0};
+    std::chrono::duration<double> const wall = std::chrono::steady_clock::now() - start;
+    return {WIFEXITED(status) && WEXITSTATUS(status) == 0, wall.count(),
+        seconds(usage.ru_utime) + seconds(usage.ru_stime), usage.ru_maxrss};
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<char *> command;
+    int i = 1;
+    for(; i < argc && std::strcmp(argv[i], "--") != 0; ++i)
+        command.push_back(argv[i]);
+    if(command.empty() || i + 1 >= argc)
+    {
+        std::cerr << "usage: " << argv[0] << " <compiler> [<flags>...] -- <source>...\n";
+        return 2;
+    }
+
+    int failures = 0;
+    double total_wall = 0, total_cpu = 0;
+    long max_rss = 0;
+    std::printf("%-40s %10s %10s %12s\n", "source", "wall (s)", "cpu (s)", "peak (MB)");
+    for(++i; i < argc; ++i)
+    {
+        std::vector<char *> args = command;
+        args.push_back(argv[i]);
+        measurement const m = compile(args);
+        std::string name = argv[i];
+        name = name.substr(name.find_last_of('/') + 1);
+        if(!m.ok)
+        {
+            std::printf("%-40s %10s\n", name.c_str(), "FAILED");
+            ++failures;
+            continue;
+        }
+        std::printf("%-40s %10.2f %10.2f %12.1f\n", name.c_str(), m.wall, m.cpu,
+            m.max_rss / 1024.0);
+        total_wall += m.wall;
+        total_cpu += m.cpu;
+        max_rss = m.max_rss > max_rss ? m.max_rss : max_rss;
+    }
+    std::printf("%-40s %10.2f %10.2f %12.1f\n", "total", total_wall, total_cpu,
+        max_rss / 1024.0);
+    return failures == 0 ? 0 : 1;
+}
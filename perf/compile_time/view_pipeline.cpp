@@ -0,0 +1,31 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// A typical lazy pipeline over a container, materialized into a vector.
+
+#include <string>
+#include <vector>
+#include <range/v3/all.hpp>
+
+int main()
+{
+    using namespace ranges;
+    std::vector<int> v = view::ints(0, 1000);
+    std::vector<std::string> s =
+        v | view::transform([](int i) { return i * i; })
+          | view::stride(3)
+          | view::take(100)
+          | view::transform([](int i) { return std::to_string(i); })
+          | view::remove_if([](std::string const &s) { return s.size() < 3; });
+    int sum = accumulate(v | view::reverse | view::take(10), 0);
+    return (int)s.size() + sum;
+}
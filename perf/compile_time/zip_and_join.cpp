@@ -0,0 +1,39 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Views of several ranges at once, whose reference types are proxies with
+// user-defined common references.
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <range/v3/all.hpp>
+
+int main()
+{
+    using namespace ranges;
+    std::vector<int> keys = {3, 1, 2};
+    std::vector<std::string> names = {"three", "one", "two"};
+    auto z = view::zip(keys, names);
+    sort(z);
+    std::vector<std::vector<int>> vv = {{1, 2}, {3}, {4, 5, 6}};
+    std::vector<int> flat = vv | view::join;
+    std::vector<std::pair<int, std::string>> kv = view::zip(keys, names);
+    int n = 0;
+    RANGES_FOR(auto p, view::hash_join(keys, flat))
+        n += p.first + p.second;
+    RANGES_FOR(auto p, view::merge_join(keys, view::ints(0, 10)))
+        n += p.first;
+    RANGES_FOR(auto s, view::concat(names, view::single(std::string("four"))))
+        n += int(s.size());
+    return n + int(kv.size());
+}
@@ -0,0 +1,50 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <vector>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/drop.hpp>
+#include <range/v3/algorithm/random_shuffle.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/all_of.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/action/nth_element.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v = view::ints(0,99);
+    random_shuffle(v);
+
+    auto v2 = v | copy | action::nth_element(42);
+    ::models<concepts::Same>(v, v2);
+    CHECK(size(v2) == 100u);
+    CHECK(v2[42] == 42);
+    CHECK(all_of(view::take(v2, 42), [](int i){return i < 42;}));
+    CHECK(all_of(view::drop(v2, 43), [](int i){return i > 42;}));
+
+    auto & v3 = action::nth_element(v, 0, std::greater<int>());
+    CHECK(&v3 == &v);
+    CHECK(v[0] == 99);
+
+    // Past the end, there is nothing to do
+    auto v4 = v;
+    v4 |= action::nth_element(100);
+    CHECK(equal(v4, v));
+
+    return ::test_result();
+}
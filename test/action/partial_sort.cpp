@@ -0,0 +1,54 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <vector>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/drop.hpp>
+#include <range/v3/algorithm/random_shuffle.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/algorithm/min_element.hpp>
+#include <range/v3/action/partial_sort.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v = view::ints(0,99);
+    random_shuffle(v);
+
+    auto v2 = v | copy | action::partial_sort(10);
+    ::models<concepts::Same>(v, v2);
+    CHECK(size(v2) == 100u);
+    ::check_equal(view::take(v2, 10), view::ints(0,9));
+    auto rest = view::drop(v2, 10);
+    CHECK(*min_element(rest) == 10);
+
+    auto & v3 = action::partial_sort(v, 5, std::greater<int>());
+    CHECK(&v3 == &v);
+    ::check_equal(view::take(v, 5), {99,98,97,96,95});
+
+    v |= action::partial_sort(200);
+    CHECK(size(v) == 100u);
+    CHECK(is_sorted(v));
+
+    std::vector<std::pair<int, char>> p{{3,'c'},{1,'a'},{4,'d'},{2,'b'}};
+    p |= action::partial_sort(2, ordered_less{}, &std::pair<int, char>::second);
+    CHECK(p[0].second == 'a');
+    CHECK(p[1].second == 'b');
+
+    return ::test_result();
+}
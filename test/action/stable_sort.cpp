@@ -0,0 +1,48 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/action/stable_sort.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    // Mostly ordered "timestamps", with several events at each one.
+    std::vector<std::pair<int, int>> v;
+    for(int i = 0; i < 1000; ++i)
+        v.emplace_back(i / 4 + (i % 7 == 0 ? 3 : 0), i);
+    CHECK(!is_sorted(v, std::less<int>(), &std::pair<int, int>::first));
+
+    auto v2 = v | copy | action::stable_sort(std::less<int>(), &std::pair<int, int>::first);
+    CHECK(size(v2) == size(v));
+    CHECK(is_sorted(v2, std::less<int>(), &std::pair<int, int>::first));
+    // Events with equal timestamps keep their original order.
+    CHECK(is_sorted(v2));
+
+    v |= action::stable_sort;
+    CHECK(is_sorted(v));
+    ::check_equal(v, v2);
+
+    auto & v3 = action::stable_sort(v, std::greater<std::pair<int, int>>());
+    CHECK(&v3 == &v);
+    ::check_equal(view::take(v, 3) | view::transform(&std::pair<int, int>::second),
+        {994, 999, 998});
+
+    return ::test_result();
+}
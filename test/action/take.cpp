@@ -7,10 +7,12 @@
 //  file LICENSE_1_0.txt or copy at
 //  http://www.boost.org/LICENSE_1_0.txt)
 
+#include <functional>
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/algorithm/move.hpp>
+#include <range/v3/action/sort.hpp>
 #include <range/v3/action/take.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
@@ -39,5 +41,18 @@ int main()
     v |= action::take(0);
     CHECK(v.size() == 0u);
 
+    // sort followed by take sorts only the elements that are kept
+    v = {9,2,7,4,5,0,3,8,1,6};
+    v |= action::sort | action::take(4);
+    ::check_equal(v, {0,1,2,3});
+
+    v = {9,2,7,4,5,0,3,8,1,6};
+    v |= action::sort(std::greater<int>()) | action::take(3);
+    ::check_equal(v, {9,8,7});
+
+    v = {3,1,2};
+    v |= action::sort | action::take(100);
+    ::check_equal(v, {1,2,3});
+
     return ::test_result();
 }
@@ -0,0 +1,52 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/algorithm/random_shuffle.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/action/top_k.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v = view::ints(0,99);
+    random_shuffle(v);
+
+    auto v2 = v | copy | action::top_k(5);
+    ::models<concepts::Same>(v, v2);
+    ::check_equal(v2, {99,98,97,96,95});
+
+    auto & v3 = action::top_k(v, 3);
+    CHECK(&v3 == &v);
+    ::check_equal(v, {99,98,97});
+
+    v |= action::top_k(10);
+    ::check_equal(v, {99,98,97});
+
+    v |= action::top_k(0);
+    CHECK(v.empty());
+
+    // Ranked by a projection
+    std::vector<std::pair<std::string, int>> scores{
+        {"ann", 30}, {"bob", 75}, {"cat", 50}, {"dan", 90}, {"eve", 10}};
+    scores |= action::top_k(2, &std::pair<std::string, int>::second);
+    CHECK(scores.size() == 2u);
+    CHECK(scores[0].first == "dan");
+    CHECK(scores[1].first == "bob");
+
+    return ::test_result();
+}
@@ -8,12 +8,14 @@
 //  http://www.boost.org/LICENSE_1_0.txt)
 
 #include <array>
+#include <string>
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/algorithm/move.hpp>
 #include <range/v3/algorithm/equal.hpp>
+#include <range/v3/action/remove_if.hpp>
 #include <range/v3/action/transform.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
@@ -31,5 +33,20 @@ int main()
     action::transform(v, [](int i){return i*i;});
     ::check_equal(v, {0,1,4,9,16,25,36,49,64,81});
 
+    // remove_if followed by transform is done in one pass
+    auto square_evens = action::remove_if([](int i){return i % 2 == 1;}) |
+        action::transform([](int i){return i*i;});
+    std::vector<int> v1 = view::ints(0,9);
+    v1 |= square_evens;
+    ::check_equal(v1, {0,4,16,36,64});
+    CHECK(&square_evens(v1) == &v1);
+    ::check_equal(v1, {0,16,256,1296,4096});
+
+    std::vector<std::string> s{"a", "", "b", "", "", "c"};
+    s = std::move(s) |
+        action::remove_if(&std::string::empty) |
+        action::transform([](std::string const &t){return t + t;});
+    ::check_equal(s, {"aa", "bb", "cc"});
+
     return ::test_result();
 }
@@ -7,6 +7,7 @@
 //  file LICENSE_1_0.txt or copy at
 //  http://www.boost.org/LICENSE_1_0.txt)
 
+#include <string>
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/view/iota.hpp>
@@ -16,7 +17,9 @@
 #include <range/v3/algorithm/random_shuffle.hpp>
 #include <range/v3/algorithm/equal.hpp>
 #include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/action/remove_if.hpp>
 #include <range/v3/action/sort.hpp>
+#include <range/v3/action/take.hpp>
 #include <range/v3/action/unique.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
@@ -37,5 +40,37 @@ int main()
     v |= action::sort | action::unique;
     CHECK(equal(v, view::ints(1,99)));
 
+    // With many duplicates, sort | unique drops them before sorting:
+    {
+        std::vector<std::string> s;
+        for(int i = 0; i < 20000; ++i)
+            s.push_back(std::to_string(i * 7919 % 500));
+        auto s2 = s;
+        s |= action::sort | action::unique;
+        s2 = std::move(s2) | action::sort;
+        s2 = std::move(s2) | action::unique;
+        CHECK(s.size() == 500u);
+        CHECK(s == s2);
+    }
+    // ...and gives up if it turns out there are few:
+    {
+        std::vector<int> w(20000);
+        for(int i = 0; i < 20000; ++i)
+            w[i] = i % 19 == 0 ? 0 : 20000 - i;
+        w |= action::sort | action::unique;
+        CHECK(w.size() == 18948u);
+        CHECK(is_sorted(w));
+        CHECK(w.front() == 0);
+        CHECK(w.back() == 19999);
+    }
+
+    // The actions before and after a fused pair are done as usual:
+    {
+        std::vector<int> w = {5,3,9,3,8,5,1,8,2};
+        w |= action::remove_if([](int i){return i == 8;}) | action::sort | action::unique |
+            action::take(3);
+        ::check_equal(w, {1,2,3});
+    }
+
     return ::test_result();
 }
@@ -0,0 +1,146 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <memory>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/heap_algorithm.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+struct S
+{
+    int i, j;
+};
+
+struct counting_less
+{
+    int *count;
+    bool operator()(int a, int b) const
+    {
+        ++*count;
+        return a < b;
+    }
+};
+
+// A heap with d children per node, checked the slow way.
+template<std::size_t D>
+bool is_dary_heap(std::vector<int> const &v)
+{
+    for(std::size_t i = 1; i < v.size(); ++i)
+        if(v[(i - 1) / D] < v[i])
+            return false;
+    return true;
+}
+
+template<std::size_t D>
+void test(int N)
+{
+    std::vector<int> v(N);
+    for(int i = 0; i < N; ++i)
+        v[i] = std::rand() % (N / 2 + 1);
+    std::vector<int> sorted = v;
+    std::sort(sorted.begin(), sorted.end());
+
+    CHECK(ranges::make_dary_heap_fn<D>{}(v) == v.end());
+    CHECK(is_dary_heap<D>(v));
+    CHECK(ranges::is_dary_heap_fn<D>{}(v));
+    CHECK(ranges::is_dary_heap_until_fn<D>{}(v) == v.end());
+
+    // pop everything, then push it all back
+    for(int i = N; i > 0; --i)
+    {
+        CHECK(ranges::pop_dary_heap_fn<D>{}(v.begin(), v.begin() + i) == v.begin() + i);
+        CHECK(v[i - 1] == sorted[i - 1]);
+        CHECK(ranges::is_dary_heap_fn<D>{}(v.begin(), v.begin() + (i - 1)));
+    }
+    ::check_equal(v, sorted);
+    for(int i = 1; i <= N; ++i)
+    {
+        CHECK(ranges::push_dary_heap_fn<D>{}(v.begin(), v.begin() + i) == v.begin() + i);
+        CHECK(ranges::is_dary_heap_fn<D>{}(v.begin(), v.begin() + i));
+    }
+    CHECK(ranges::sort_dary_heap_fn<D>{}(v) == v.end());
+    ::check_equal(v, sorted);
+
+    // is_heap_until finds the first child greater than its parent
+    if(N > 2)
+    {
+        v.assign(N, 0);
+        v[N - 1] = 1;
+        CHECK(!ranges::is_dary_heap_fn<D>{}(v));
+        CHECK(ranges::is_dary_heap_until_fn<D>{}(v) == v.end() - 1);
+    }
+}
+
+int main()
+{
+    for(int N : {0, 1, 2, 3, 4, 5, 8, 9, 17, 100, 1000})
+    {
+        test<2>(N);
+        test<3>(N);
+        test<4>(N);
+        test<8>(N);
+    }
+
+    // Binary heaps are the std:: layout
+    {
+        std::vector<int> v(1000);
+        for(int &i : v)
+            i = std::rand();
+        ranges::make_heap(v);
+        CHECK(std::is_heap(v.begin(), v.end()));
+        CHECK(is_dary_heap<2>(v));
+    }
+
+    // Bottom-up pop_heap does about one comparison per level
+    {
+        std::vector<int> v(1 << 14);
+        for(int &i : v)
+            i = std::rand();
+        ranges::make_heap(v);
+        int count = 0;
+        for(auto i = v.size(); i > 1; --i)
+            ranges::pop_heap(v.begin(), v.begin() + i, counting_less{&count});
+        CHECK(ranges::is_sorted(v));
+        // a top-down sift would need close to 2 * 13 per pop
+        CHECK(count < (int)v.size() * 15);
+    }
+
+    // Projections and move-only types
+    {
+        std::vector<S> v;
+        for(int i = 0; i < 100; ++i)
+            v.push_back(S{i % 10, i});
+        ranges::make_dary_heap_fn<4>{}(v, std::less<int>{}, &S::i);
+        ranges::sort_dary_heap_fn<4>{}(v, std::less<int>{}, &S::i);
+        CHECK(ranges::is_sorted(v, std::less<int>{}, &S::i));
+
+        std::vector<std::unique_ptr<int>> u;
+        for(int i = 0; i < 100; ++i)
+            u.emplace_back(new int(i * 37 % 100));
+        auto less = [](std::unique_ptr<int> const &a, std::unique_ptr<int> const &b)
+        {
+            return *a < *b;
+        };
+        ranges::make_dary_heap_fn<8>{}(u, less);
+        ranges::sort_dary_heap_fn<8>{}(u, less);
+        for(int i = 0; i < 100; ++i)
+            CHECK(*u[i] == i);
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,90 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <utility>
+#include <vector>
+#include <algorithm>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/eytzinger.hpp>
+#include <range/v3/algorithm/lower_bound.hpp>
+#include <range/v3/algorithm/upper_bound.hpp>
+#include <range/v3/algorithm/equal_range.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+int main()
+{
+    {
+        int const sorted[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        int tree[10] = {};
+        auto res = ranges::eytzinger_layout(sorted, ranges::begin(tree));
+        CHECK(res.first == ranges::end(sorted));
+        CHECK(res.second == ranges::end(tree));
+        ::check_equal(tree, {6, 3, 8, 1, 5, 7, 9, 0, 2, 4});
+
+        // The input is read front to back exactly once.
+        int tree2[10] = {};
+        auto res2 = ranges::eytzinger_layout(forward_iterator<int const *>(sorted),
+            sentinel<int const *>(sorted + 10), tree2);
+        CHECK(res2.first.base() == sorted + 10);
+        CHECK(res2.second == tree2 + 10);
+        ::check_equal(tree2, tree);
+    }
+
+    // Compare against the standard algorithms for many sizes, with duplicates,
+    // so that every shape of tree and every branchless loop trip count is hit.
+    for(int n = 0; n < 70; ++n)
+    {
+        std::vector<int> sorted;
+        for(int i = 0; i < n; ++i)
+            sorted.push_back(i / 2 * 2);
+        std::vector<int> tree(sorted.size());
+        ranges::eytzinger_layout(sorted, tree.begin());
+
+        for(int val = -1; val <= n + 1; ++val)
+        {
+            auto lb = std::lower_bound(sorted.begin(), sorted.end(), val);
+            auto ub = std::upper_bound(sorted.begin(), sorted.end(), val);
+            CHECK(ranges::lower_bound(sorted, val) == lb);
+            CHECK(ranges::upper_bound(sorted, val) == ub);
+            CHECK(ranges::equal_range(sorted, val).begin() == lb);
+            CHECK(ranges::equal_range(sorted, val).end() == ub);
+
+            auto elb = ranges::eytzinger_lower_bound(tree, val);
+            auto eub = ranges::eytzinger_upper_bound(tree, val);
+            CHECK((elb == tree.end()) == (lb == sorted.end()));
+            CHECK((eub == tree.end()) == (ub == sorted.end()));
+            if(elb != tree.end())
+                CHECK(*elb == *lb);
+            if(eub != tree.end())
+                CHECK(*eub == *ub);
+        }
+    }
+
+    // Projections and custom orderings
+    {
+        std::pair<int, int> const sorted[] = {{5, 0}, {4, 1}, {3, 2}, {2, 3}, {1, 4}};
+        std::pair<int, int> tree[5];
+        ranges::eytzinger_layout(sorted, ranges::begin(tree));
+        auto it = ranges::eytzinger_lower_bound(tree, 3, std::greater<int>(),
+            &std::pair<int, int>::first);
+        CHECK(it->second == 2);
+        it = ranges::eytzinger_upper_bound(tree, 3, std::greater<int>(),
+            &std::pair<int, int>::first);
+        CHECK(it->second == 3);
+        it = ranges::eytzinger_lower_bound(tree, 0, std::greater<int>(),
+            &std::pair<int, int>::first);
+        CHECK(it == ranges::end(tree));
+    }
+
+    return ::test_result();
+}
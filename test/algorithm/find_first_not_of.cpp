@@ -0,0 +1,109 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/find_first_not_of.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+#include "../test_utils.hpp"
+
+namespace rng = ranges;
+
+void test_iter()
+{
+    int ia[] = {1, 3, 1, 3, 0, 1, 2, 3};
+    static constexpr unsigned sa = rng::size(ia);
+    int ib[] = {1, 3, 5, 7};
+    static constexpr unsigned sb = rng::size(ib);
+    CHECK(rng::find_first_not_of(input_iterator<const int*>(ia),
+                                 sentinel<const int*>(ia + sa),
+                                 forward_iterator<const int*>(ib),
+                                 sentinel<const int*>(ib + sb)) ==
+                                 input_iterator<const int*>(ia+4));
+    CHECK(rng::find_first_not_of(input_iterator<const int*>(ia),
+                                 sentinel<const int*>(ia + 4),
+                                 forward_iterator<const int*>(ib),
+                                 sentinel<const int*>(ib + sb)) ==
+                                 input_iterator<const int*>(ia+4));
+    // Nothing is one of no needles.
+    CHECK(rng::find_first_not_of(input_iterator<const int*>(ia),
+                                 sentinel<const int*>(ia + sa),
+                                 forward_iterator<const int*>(ib),
+                                 sentinel<const int*>(ib)) ==
+                                 input_iterator<const int*>(ia));
+    CHECK(rng::find_first_not_of(input_iterator<const int*>(ia),
+                                 sentinel<const int*>(ia),
+                                 forward_iterator<const int*>(ib),
+                                 sentinel<const int*>(ib + sb)) ==
+                                 input_iterator<const int*>(ia));
+}
+
+struct S
+{
+    int i;
+};
+
+void test_rng_pred_proj()
+{
+    S ia[] = {S{1}, S{3}, S{2}, S{3}};
+    S ib[] = {S{1}, S{3}};
+    CHECK(rng::find_first_not_of(ia, ia + 4, ib, ib + 2, std::equal_to<int>(), &S::i, &S::i) ==
+        ia + 2);
+    CHECK(rng::find_first_not_of(ia, ia + 4, ib, ib + 2, [](int i, int j){ return i <= j; },
+        &S::i, &S::i) == ia + 4);
+}
+
+// Byte-sized elements are looked up in a table, and many needles in a hash set.
+void test_sets()
+{
+    std::string line = "  \t GET /";
+    std::string space = " \t";
+    CHECK(rng::find_first_not_of(line, space) == line.begin() + 4);
+    CHECK(rng::find_first_not_of(line.begin(), line.begin() + 4, space.begin(), space.end()) ==
+        line.begin() + 4);
+    CHECK(rng::find_first_not_of(line, std::string{}) == line.begin());
+
+    unsigned char uc[256];
+    for(int i = 0; i < 256; ++i)
+        uc[i] = (unsigned char)(255 - i);
+    unsigned char high[128];
+    for(int i = 0; i < 128; ++i)
+        high[i] = (unsigned char)(128 + i);
+    CHECK(rng::find_first_not_of(uc, uc + 256, high, high + 128) == uc + 128);
+
+    std::vector<int> haystack;
+    for(int i = 0; i < 100; ++i)
+        haystack.push_back(i % 40);
+    std::vector<int> needles;
+    for(int i = 0; i < 50; ++i)
+        needles.push_back(i);
+    CHECK(rng::find_first_not_of(haystack, needles) == haystack.end());
+    needles.erase(needles.begin() + 39);
+    CHECK(rng::find_first_not_of(haystack, needles) == haystack.begin() + 39);
+
+    std::vector<std::string> words = {"alpha", "beta", "gamma", "delta"};
+    std::vector<std::string> keys;
+    for(int i = 0; i < 20; ++i)
+        keys.push_back(std::string(i, 'x'));
+    keys.push_back("beta");
+    keys.push_back("alpha");
+    CHECK(rng::find_first_not_of(words, keys) == words.begin() + 2);
+}
+
+int main()
+{
+    ::test_iter();
+    ::test_rng_pred_proj();
+    ::test_sets();
+    return ::test_result();
+}
@@ -18,6 +18,8 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <string>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/find_first_of.hpp>
 #include "../simple_test.hpp"
@@ -193,6 +195,48 @@ void test_rng_pred_proj()
                              input_iterator<const S*>(ia));
 }
 
+// Byte-sized elements are looked up in a table, and many needles in a hash set.
+void test_sets()
+{
+    using namespace ranges;
+    std::string line = "GET /index.html HTTP/1.1\r\n";
+    std::string delims = " \r\n";
+    CHECK(rng::find_first_of(line, delims) == line.begin() + 3);
+    CHECK(rng::find_first_of(line.begin() + 4, line.end(), delims.begin(), delims.end()) ==
+        line.begin() + 15);
+    CHECK(rng::find_first_of(line, std::string{}) == line.end());
+    CHECK(rng::find_first_of(line, std::string{"qz"}) == line.end());
+
+    // All 256 values, and signed bytes that differ only in their sign bit.
+    signed char sc[] = {0, 1, -1, 127, -128};
+    signed char sneedles[] = {-128};
+    CHECK(rng::find_first_of(sc, sc + 5, sneedles, sneedles + 1) == sc + 4);
+    unsigned char uc[256];
+    for(int i = 0; i < 256; ++i)
+        uc[i] = (unsigned char)(255 - i);
+    unsigned char uneedles[] = {0x80, 3};
+    CHECK(rng::find_first_of(uc, uc + 256, uneedles, uneedles + 2) == uc + 0x7f);
+
+    std::vector<int> haystack;
+    for(int i = 0; i < 1000; ++i)
+        haystack.push_back(i * 7);
+    std::vector<int> needles;
+    for(int i = 0; i < 50; ++i)
+        needles.push_back(1 + i * 2); // odd, so they only match odd multiples of 7
+    CHECK(rng::find_first_of(haystack, needles) == haystack.begin() + 1);
+    needles.erase(needles.begin() + 3); // 7
+    CHECK(rng::find_first_of(haystack, needles) == haystack.begin() + 3);
+    CHECK(rng::find_first_of(haystack.begin(), haystack.begin() + 3, needles.begin(),
+        needles.end()) == haystack.begin() + 3);
+
+    std::vector<std::string> words = {"alpha", "beta", "gamma", "delta"};
+    std::vector<std::string> keys;
+    for(int i = 0; i < 20; ++i)
+        keys.push_back(std::string(i, 'x'));
+    CHECK(rng::find_first_of(words, keys) == words.end());
+    keys.push_back("gamma");
+    CHECK(rng::find_first_of(words, keys) == words.begin() + 2);
+}
 
 int main()
 {
@@ -201,5 +245,6 @@ int main()
     ::test_rng();
     ::test_rng_pred();
     ::test_rng_pred_proj();
+    ::test_sets();
     return ::test_result();
 }
\ No newline at end of file
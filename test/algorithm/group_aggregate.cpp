@@ -0,0 +1,84 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <map>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/group_aggregate.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+struct sale
+{
+    std::string region;
+    int amount;
+};
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<sale> sales = {
+        {"west", 10}, {"east", 5}, {"west", 7}, {"north", 1}, {"east", 2}, {"west", 3}};
+
+    // Sum by key, groups in order of first appearance
+    {
+        auto groups = group_aggregate(sales, &sale::region, 0, plus{}, &sale::amount);
+        CHECK(groups.size() == 3u);
+        CHECK(groups[0].first == "west");
+        CHECK(groups[0].second == 20);
+        CHECK(groups[1].first == "east");
+        CHECK(groups[1].second == 7);
+        CHECK(groups[2].first == "north");
+        CHECK(groups[2].second == 1);
+    }
+
+    // Count by key
+    {
+        auto counts = group_aggregate(sales, &sale::region, 0,
+            [](int n, sale const &) { return n + 1; });
+        CHECK(counts[0].second == 3);
+        CHECK(counts[1].second == 2);
+        CHECK(counts[2].second == 1);
+    }
+
+    // Collect the values of each group
+    {
+        int a[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+        auto groups = group_aggregate(input_iterator<int*>(a), sentinel<int*>(a + 10),
+            [](int i) { return i % 3; }, std::vector<int>{},
+            [](std::vector<int> v, int i) { v.push_back(i); return v; });
+        CHECK(groups.size() == 3u);
+        CHECK(groups[0].first == 1);
+        ::check_equal(groups[0].second, {1, 4, 7, 10});
+        ::check_equal(groups[1].second, {2, 5, 8});
+        ::check_equal(groups[2].second, {3, 6, 9});
+    }
+
+    // Many groups, checked against std::map
+    {
+        std::vector<int> v;
+        for(int i = 0; i < 100000; ++i)
+            v.push_back((i * 2654435761u) % 5003);
+        auto groups = group_aggregate(v, ident{}, 0L, plus{});
+        std::map<int, long> expected;
+        for(int i : v)
+            expected[i] += i;
+        CHECK(groups.size() == expected.size());
+        for(auto const &g : groups)
+            CHECK(g.second == expected[g.first]);
+    }
+
+    return ::test_result();
+}
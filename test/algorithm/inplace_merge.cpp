@@ -19,6 +19,7 @@
 //===----------------------------------------------------------------------===//
 
 #include <cassert>
+#include <vector>
 #include <algorithm>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/inplace_merge.hpp>
@@ -112,10 +113,25 @@ test()
 
 int main()
 {
-    // test<forward_iterator<int*> >();
+    test<forward_iterator<int*> >();
     test<bidirectional_iterator<int*> >();
     test<random_access_iterator<int*> >();
     test<int*>();
 
+    // The rotation-based merge used when no buffer is available
+    for(unsigned N : {0u, 1u, 2u, 17u, 1000u})
+        for(unsigned M : {0u, N / 3, N / 2, N})
+        {
+            std::vector<int> v(N);
+            for(unsigned i = 0; i < N; ++i)
+                v[i] = i % 7;
+            std::sort(v.begin(), v.begin() + M);
+            std::sort(v.begin() + M, v.end());
+            using I = forward_iterator<int*>;
+            ranges::detail::forward_merge_no_buffer(I(v.data()), I(v.data() + M),
+                I(v.data() + N), (int)M, (int)(N - M), ranges::ordered_less{}, ranges::ident{});
+            CHECK(std::is_sorted(v.begin(), v.end()));
+        }
+
     return ::test_result();
 }
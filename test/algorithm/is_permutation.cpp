@@ -22,7 +22,10 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <string>
+#include <vector>
 #include <utility>
+#include <algorithm>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/permutation.hpp>
 #include "../simple_test.hpp"
@@ -48,8 +51,39 @@ struct T
     int i;
 };
 
+// Large ranges are hashed or sorted rather than counted element by element.
+template<typename T, typename Make>
+void test_large(Make make)
+{
+    std::vector<T> a, b;
+    for(int i = 0; i < 1000; ++i)
+        a.push_back(make(i % 300));
+    b = a;
+    std::reverse(b.begin(), b.end());
+    std::swap(b[10], b[700]);
+    CHECK(ranges::is_permutation(a, b) == true);
+    CHECK(ranges::is_permutation(a.begin(), a.end(), b.begin()) == true);
+    CHECK(ranges::is_permutation(forward_iterator<T const *>(a.data()),
+                                 sentinel<T const *>(a.data() + a.size()),
+                                 forward_iterator<T const *>(b.data()),
+                                 sentinel<T const *>(b.data() + b.size())) == true);
+    // Same elements, but one more of one and one fewer of another.
+    b[0] = make(299);
+    CHECK(ranges::is_permutation(a, b) == false);
+    CHECK(ranges::is_permutation(a.begin(), a.end(), b.begin()) == false);
+    // An element that is not in a at all.
+    b[0] = make(1000);
+    CHECK(ranges::is_permutation(a, b) == false);
+    b.pop_back();
+    CHECK(ranges::is_permutation(a, b) == false);
+}
+
 int main()
 {
+    test_large<int>([](int i) { return i; });
+    test_large<std::string>([](int i) { return std::to_string(i); });
+    test_large<std::pair<int, int>>([](int i) { return std::make_pair(i / 7, i % 7); });
+
     {
         const int ia[] = {0};
         const int ib[] = {0};
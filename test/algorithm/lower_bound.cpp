@@ -13,9 +13,11 @@
 //  Distributed under the MIT License(see accompanying file LICENSE_1_0_0.txt
 //  or a copy at http://stlab.adobe.com/licenses.html)
 
+#include <vector>
 #include <utility>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/lower_bound.hpp>
+#include <range/v3/view/transform.hpp>
 #include "../simple_test.hpp"
 
 int main()
@@ -45,5 +47,18 @@ int main()
     CHECK(ranges::lower_bound(a, 1, less(), &std::pair<int, int>::first) == &a[2]);
     CHECK(ranges::lower_bound(c, 1, less(), &std::pair<int, int>::first) == &c[2]);
 
+    // Only the elements compared are read: prefetching doesn't dereference iterators
+    // that run user code.
+    {
+        std::vector<int> v(1024);
+        for(int i = 0; i < 1024; ++i)
+            v[i] = i;
+        int reads = 0;
+        auto rng = ranges::view::transform(v, [&](int &i) -> int & { ++reads; return i; });
+        auto it = ranges::lower_bound(rng, 300);
+        CHECK(reads == 11);
+        CHECK(*it == 300);
+    }
+
     return test_result();
 }
@@ -21,6 +21,7 @@
 #include <cassert>
 #include <memory>
 #include <algorithm>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/nth_element.hpp>
 #include "../simple_test.hpp"
@@ -59,6 +60,61 @@ test(unsigned N)
     test_one(N, N-1);
 }
 
+// McIlroy's "killer adversary" for quicksort: it decides the relative order of
+// elements only when forced to, in whatever way hurts the pivot choice most.
+struct adversary
+{
+    std::vector<int> *val;
+    int *nsolid, *candidate, *ncmp;
+    int gas;
+    bool operator()(int x, int y) const
+    {
+        ++*ncmp;
+        if((*val)[x] == gas && (*val)[y] == gas)
+            (*val)[x == *candidate ? x : y] = (*nsolid)++;
+        if((*val)[x] == gas)
+            *candidate = x;
+        else if((*val)[y] == gas)
+            *candidate = y;
+        return (*val)[x] < (*val)[y];
+    }
+};
+
+void
+test_adversary(int N, int M)
+{
+    std::vector<int> val(N, N), a(N);
+    for(int i = 0; i < N; ++i)
+        a[i] = i;
+    int nsolid = 0, candidate = 0, ncmp = 0;
+    ranges::nth_element(a, a.begin() + M, adversary{&val, &nsolid, &candidate, &ncmp, N});
+    // Linear, not quadratic.
+    CHECK(ncmp < 32 * N);
+    for(int i = 0; i < M; ++i)
+        CHECK(val[a[i]] <= val[a[M]]);
+    for(int i = M + 1; i < N; ++i)
+        CHECK(val[a[M]] <= val[a[i]]);
+}
+
+void
+test_median_of_medians(unsigned N, unsigned M)
+{
+    std::vector<int> v(N);
+    for(unsigned i = 0; i < N; ++i)
+        v[i] = (int)(i % 37);
+    std::random_shuffle(v.begin(), v.end());
+    std::vector<int> sorted = v;
+    std::sort(sorted.begin(), sorted.end());
+    ranges::less pred;
+    ranges::ident proj;
+    ranges::detail::median_of_medians_select(v.begin(), v.begin() + M, v.end(), pred, proj);
+    CHECK(v[M] == sorted[M]);
+    for(unsigned i = 0; i < M; ++i)
+        CHECK(v[i] <= v[M]);
+    for(unsigned i = M + 1; i < N; ++i)
+        CHECK(v[M] <= v[i]);
+}
+
 struct S
 {
     int i,j;
@@ -77,6 +133,16 @@ int main()
     test(1000);
     test(1009);
 
+    test_adversary(10000, 0);
+    test_adversary(10000, 5000);
+    test_adversary(10001, 9999);
+
+    test_median_of_medians(1, 0);
+    test_median_of_medians(11, 5);
+    test_median_of_medians(500, 0);
+    test_median_of_medians(500, 250);
+    test_median_of_medians(1009, 1008);
+
     // Works with projections?
     const int N = 257;
     const int M = 56;
@@ -23,9 +23,12 @@
 //===----------------------------------------------------------------------===//
 
 #include <memory>
+#include <vector>
 #include <utility>
+#include <iterator>
 #include <functional>
 #include <range/v3/core.hpp>
+#include <range/v3/algorithm/copy_if.hpp>
 #include <range/v3/algorithm/remove_copy_if.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
@@ -152,5 +155,42 @@ int main()
         CHECK(ib[5] == 4);
     }
 
+    // Check the branchless path for contiguous numbers, across several blocks
+    {
+        std::vector<int> v(1000);
+        for(int i = 0; i < 1000; ++i)
+            v[i] = (i * 7) % 10;
+        auto const small = [](int i){return i < 5;};
+        std::vector<int> w;
+        auto r = ranges::remove_copy_if(v, ranges::back_inserter(w), small);
+        CHECK(r.first == v.end());
+        CHECK(w.size() == 500u);
+        std::vector<int> x;
+        std::remove_copy_if(v.begin(), v.end(), std::back_inserter(x), small);
+        CHECK(w == x);
+
+        float fa[] = {0.5f, 2.f, -1.f, 3.f};
+        float fb[4];
+        std::pair<float*, float*> rf = ranges::remove_copy_if(fa, fb,
+            [](float f){return f < 1.f;});
+        CHECK(rf.first == fa + 4);
+        CHECK(rf.second == fb + 2);
+        CHECK(fb[0] == 2.f);
+        CHECK(fb[1] == 3.f);
+
+        CHECK(ranges::remove_copy_if(fa, fa, fb, small).second == fb);
+
+        // A predicate taking the elements by non-const reference
+        int ic[] = {1, 2, 3, 4};
+        int id[4];
+        CHECK(ranges::remove_copy_if(ic, id, [](int &i){return i % 2 == 0;}).second
+            == id + 2);
+        CHECK(id[0] == 1);
+        CHECK(id[1] == 3);
+        std::vector<int> w2;
+        ranges::copy_if(v, ranges::back_inserter(w2), [](int &i){return i >= 5;});
+        CHECK(w2 == x);
+    }
+
     return ::test_result();
 }
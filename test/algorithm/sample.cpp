@@ -0,0 +1,140 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <random>
+#include <vector>
+#include <sstream>
+#include <cstdlib>
+#include <algorithm>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/sample.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/view/generate.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+struct item
+{
+    int id;
+    double weight;
+};
+
+int main()
+{
+    using namespace ranges;
+    std::mt19937 gen;
+
+    // Selection sampling keeps the input order
+    {
+        std::list<int> l = view::ints(0, 99);
+        std::vector<int> out(10);
+        auto res = sample(l, out.begin(), 10, gen);
+        CHECK(res.first == l.end());
+        CHECK(res.second == out.end());
+        CHECK(is_sorted(out));
+        CHECK(std::adjacent_find(out.begin(), out.end()) == out.end());
+
+        std::vector<int> all;
+        sample(l.begin(), l.end(), ranges::back_inserter(all), 1000, gen);
+        CHECK(all.size() == 100u);
+        CHECK(is_sorted(all));
+    }
+
+    // Reservoir sampling on single-pass input
+    {
+        int counts[50] = {};
+        int a[50];
+        for(int i = 0; i < 50; ++i)
+            a[i] = i;
+        for(int t = 0; t < 20000; ++t)
+        {
+            int out[5];
+            auto res = sample(input_iterator<int*>(a), sentinel<int*>(a + 50), out, 5, gen);
+            CHECK(res.first.base() == a + 50);
+            CHECK(res.second == out + 5);
+            std::sort(out, out + 5);
+            CHECK(std::adjacent_find(out, out + 5) == out + 5);
+            for(int i : out)
+                ++counts[i];
+        }
+        // Each element is in the sample with probability 1/10
+        for(int c : counts)
+            CHECK(std::abs(c - 2000) < 250);
+
+        // Not enough input to fill the reservoir
+        int out[5];
+        auto res = sample(input_iterator<int*>(a), sentinel<int*>(a + 3), out, 5, gen);
+        CHECK(res.second == out + 3);
+        ::check_equal(make_range(out, out + 3), {0, 1, 2});
+    }
+
+    // istream_range and view::generate
+    {
+        std::stringstream sin;
+        for(int i = 0; i < 100000; ++i)
+            sin << i << ' ';
+        auto rng = istream<int>(sin);
+        std::vector<int> out(20);
+        auto res = sample(rng, out.begin(), 20, gen);
+        CHECK(res.second == out.end());
+        std::sort(out.begin(), out.end());
+        CHECK(std::adjacent_find(out.begin(), out.end()) == out.end());
+        CHECK(out.back() < 100000);
+
+        int i = 0;
+        auto g = view::generate([&]{ return i++; }) | view::take(1000);
+        std::vector<int> out2(10);
+        sample(g, out2.begin(), 10);
+        for(int j : out2)
+            CHECK((0 <= j && j < 1000));
+    }
+
+    // Weighted sampling
+    {
+        std::vector<item> items = {{0, 1.0}, {1, 2.0}, {2, 0.0}, {3, 4.0}, {4, 1.0}};
+        int counts[5] = {};
+        for(int t = 0; t < 16000; ++t)
+        {
+            item out[1];
+            auto res = weighted_sample(items, out, 1, gen, &item::weight);
+            CHECK(res.second == out + 1);
+            ++counts[out[0].id];
+        }
+        CHECK(counts[2] == 0);
+        CHECK(std::abs(counts[0] - 2000) < 300);
+        CHECK(std::abs(counts[1] - 4000) < 400);
+        CHECK(std::abs(counts[3] - 8000) < 500);
+        CHECK(std::abs(counts[4] - 2000) < 300);
+
+        // Larger samples from a stream are distinct and skip zero weights
+        std::vector<item> many;
+        for(int i = 0; i < 10000; ++i)
+            many.push_back(item{i, i % 3 == 0 ? 0.0 : 1.0 + i % 7});
+        std::vector<item> out(100);
+        auto res = weighted_sample(input_iterator<item*>(many.data()),
+            sentinel<item*>(many.data() + many.size()), out.begin(), 100, gen, &item::weight);
+        CHECK(res.second == out.end());
+        std::vector<int> ids;
+        for(auto const &x : out)
+        {
+            CHECK((x.id % 3 != 0));
+            ids.push_back(x.id);
+        }
+        std::sort(ids.begin(), ids.end());
+        CHECK(std::adjacent_find(ids.begin(), ids.end()) == ids.end());
+    }
+
+    return ::test_result();
+}
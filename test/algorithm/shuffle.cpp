@@ -22,17 +22,91 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <map>
+#include <cstdlib>
 #include <random>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/equal.hpp>
 #include <range/v3/algorithm/shuffle.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
 #include <range/v3/numeric/iota.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
 
+// Every permutation of a small array should come up about equally often.
+template<typename Gen>
+void test_uniform(Gen gen)
+{
+    std::map<std::vector<int>, int> counts;
+    int const trials = 24000;
+    for(int t = 0; t < trials; ++t)
+    {
+        std::vector<int> v = {0, 1, 2, 3};
+        CHECK(ranges::shuffle(v, gen) == v.end());
+        ++counts[v];
+    }
+    CHECK(counts.size() == 24u);
+    for(auto const &p : counts)
+        CHECK(std::abs(p.second - trials / 24) < trials / 24 / 5);
+}
+
+template<typename Gen>
+void test_bounded(Gen gen)
+{
+    auto rand = ranges::detail::make_bounded_random(gen);
+    int counts[6] = {};
+    for(int t = 0; t < 60000; ++t)
+    {
+        std::uint64_t i = rand(6), j = 0, k = 0;
+        CHECK(i < 6u);
+        ++counts[i];
+        rand(6, 5, j, k);
+        CHECK(j < 6u);
+        CHECK(k < 5u);
+    }
+    for(int c : counts)
+        CHECK(std::abs(c - 10000) < 500);
+    for(std::uint64_t b : {std::uint64_t(1), std::uint64_t(3), std::uint64_t(1) << 31,
+        (std::uint64_t(1) << 32) - 1, std::uint64_t(1) << 32, ~std::uint64_t(0)})
+        CHECK(rand(b) < b);
+    // Bounds past 32 bits aren't truncated, even for 32-bit engines
+    std::uint64_t const big = (std::uint64_t(1) << 40) + 3;
+    bool high = false;
+    for(int t = 0; t < 100; ++t)
+    {
+        std::uint64_t const i = rand(big);
+        CHECK(i < big);
+        high = high || i > 0xFFFFFFFFu;
+    }
+    CHECK(high);
+}
+
 int main()
 {
+    // 32- and 64-bit engines take the multiply-and-shift paths, minstd_rand doesn't
+    // produce all bit patterns and falls back to std::uniform_int_distribution.
+    test_bounded(std::mt19937{});
+    test_bounded(std::mt19937_64{});
+    test_bounded(std::minstd_rand{});
+    test_uniform(std::mt19937{});
+    test_uniform(std::mt19937_64{});
+    test_uniform(std::minstd_rand{});
+
+    // Large shuffles are permutations
+    {
+        std::vector<int> v(100003);
+        ranges::iota(v, 0);
+        std::mt19937_64 g;
+        ranges::shuffle(v, g);
+        CHECK(!ranges::is_sorted(v));
+        ranges::sort(v);
+        for(int i = 0; i < (int)v.size(); ++i)
+            CHECK(v[i] == i);
+    }
+
     {
         int ia[100];
         int ib[100];
@@ -21,13 +21,18 @@
 #include <cassert>
 #include <memory>
 #include <vector>
+#include <forward_list>
 #include <algorithm>
+#include <cstdlib>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/sort.hpp>
 #include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/algorithm/reverse.hpp>
 #include <range/v3/view/for_each.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/repeat_n.hpp>
+#include <range/v3/view/remove_if.hpp>
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/view/zip.hpp>
 #include <range/v3/view/transform.hpp>
@@ -227,6 +232,82 @@ struct Int
     }
 };
 
+struct counting_less
+{
+    int *count;
+    bool operator()(int a, int b) const
+    {
+        ++*count;
+        return a < b;
+    }
+};
+
+// Block partitioning is normally only used for arithmetic types. Turn it on
+// for Key to check that the traits hook is honored.
+struct Key
+{
+    int k;
+};
+
+namespace ranges
+{
+    template<>
+    struct sort_traits<Key> : sort_traits<int>
+    {
+        static constexpr bool block_partition() { return true; }
+        static constexpr std::ptrdiff_t block_size() { return 7; }
+    };
+}
+
+template<class T, class Gen>
+void test_pattern(int N, Gen gen)
+{
+    std::vector<T> v;
+    for(int i = 0; i < N; ++i)
+        v.push_back(T{gen(i)});
+    std::vector<int> expected;
+    for(auto const &t : v)
+        expected.push_back(t.k);
+    std::sort(expected.begin(), expected.end());
+    ranges::sort(v, std::less<int>(), &T::k);
+    for(int i = 0; i < N; ++i)
+        CHECK(v[i].k == expected[i]);
+}
+
+struct NoBlock
+{
+    int k;
+};
+
+template<class Gen>
+void test_pattern(int N, Gen gen)
+{
+    test_pattern<Key>(N, gen);
+    test_pattern<NoBlock>(N, gen);
+
+    std::vector<int> v;
+    for(int i = 0; i < N; ++i)
+        v.push_back(gen(i));
+    std::vector<int> expected = v;
+    std::sort(expected.begin(), expected.end());
+    ranges::sort(v);
+    CHECK(v == expected);
+}
+
+void test_patterns(int N)
+{
+    std::srand(N);
+    test_pattern(N, [](int i) { return i; });
+    test_pattern(N, [=](int i) { return N - i; });
+    test_pattern(N, [](int) { return 42; });
+    test_pattern(N, [](int) { return std::rand(); });
+    test_pattern(N, [](int) { return std::rand() % 4; });
+    test_pattern(N, [=](int i) { return i < N / 2 ? i : N - i; });
+    test_pattern(N, [](int i) { return i % 17; });
+    test_pattern(N, [=](int i) { return i % 97 ? i : N - i; });
+    test_pattern(N, [](int i) { return i ^ 0x55; });
+}
+
 int main()
 {
     // test null range
@@ -253,6 +334,73 @@ int main()
     test_larger_sorts(1000);
     test_larger_sorts(1009);
 
+    test_patterns(2);
+    test_patterns(50);
+    test_patterns(1000);
+    test_patterns(30000);
+
+    // Sorted and reverse-sorted input take a single pass
+    {
+        std::vector<int> v = ranges::view::ints(0, 10000);
+        int count = 0;
+        ranges::sort(v, counting_less{&count});
+        CHECK(count == (int)v.size() - 1);
+        ranges::reverse(v);
+        count = 0;
+        ranges::sort(v, counting_less{&count});
+        CHECK(count == (int)v.size() - 1);
+        CHECK(ranges::is_sorted(v));
+    }
+
+    // Forward iterators
+    {
+        std::srand(1000);
+        std::vector<int> v(1000);
+        for(int &i : v)
+            i = std::rand() % 100;
+        std::forward_list<int> l(v.begin(), v.end());
+        std::sort(v.begin(), v.end());
+        CHECK(ranges::sort(l) == l.end());
+        ::check_equal(l, v);
+
+        std::vector<int> w(v.rbegin(), v.rend());
+        auto e = ranges::sort(forward_iterator<int*>(w.data()),
+            sentinel<int*>(w.data() + w.size()));
+        CHECK(e.base() == w.data() + w.size());
+        ::check_equal(w, v);
+
+        std::forward_list<std::unique_ptr<int> > u;
+        for(int i = 0; i < 1000; ++i)
+            u.emplace_front(new int(i));
+        ranges::sort(u, indirect_less());
+        int i = 0;
+        for(auto const &p : u)
+            CHECK(*p == i++);
+    }
+
+    // Bidirectional ranges: sort the odd elements in place, leaving the even ones
+    {
+        std::srand(1000);
+        std::vector<int> v(1000);
+        for(int &i : v)
+            i = std::rand() % 100;
+        auto odd = v | ranges::view::remove_if([](int i) { return i % 2 == 0; });
+        CONCEPT_ASSERT(ranges::BidirectionalIterable<decltype(odd)>());
+        CONCEPT_ASSERT(!ranges::RandomAccessIterable<decltype(odd)>());
+        std::vector<int> w = v, o;
+        for(int i : w)
+            if(i % 2 != 0)
+                o.push_back(i);
+        std::sort(o.begin(), o.end());
+        auto oi = o.begin();
+        for(int &i : w)
+            if(i % 2 != 0)
+                i = *oi++;
+        CHECK(ranges::sort(odd) == ranges::end(odd));
+        ::check_equal(v, w);
+        CHECK(ranges::is_sorted(odd));
+    }
+
     // Check move-only types
     {
         std::vector<std::unique_ptr<int> > v(1000);
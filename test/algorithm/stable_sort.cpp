@@ -21,7 +21,9 @@
 #include <cassert>
 #include <memory>
 #include <vector>
+#include <forward_list>
 #include <algorithm>
+#include <cstdlib>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/stable_sort.hpp>
 #include "../simple_test.hpp"
@@ -159,6 +161,51 @@ struct S
     int i, j;
 };
 
+// Sort (key, original position) pairs on the key only, and check the result
+// against std::stable_sort, which also checks stability.
+template<class Gen>
+void test_pattern(int N, Gen gen)
+{
+    std::vector<S> v;
+    for(int i = 0; i < N; ++i)
+        v.push_back(S{gen(i), i});
+    std::vector<S> expected = v;
+    std::stable_sort(expected.begin(), expected.end(),
+        [](S const &a, S const &b) { return a.i < b.i; });
+    std::forward_list<S> l(v.begin(), v.end());
+    ranges::stable_sort(v, std::less<int>(), &S::i);
+    for(int i = 0; i < N; ++i)
+    {
+        CHECK(v[i].i == expected[i].i);
+        CHECK(v[i].j == expected[i].j);
+    }
+    // Forward iterators take the merge sort path
+    CHECK(ranges::stable_sort(l, std::less<int>(), &S::i) == l.end());
+    auto it = l.begin();
+    for(int i = 0; i < N; ++i, ++it)
+    {
+        CHECK(it->i == expected[i].i);
+        CHECK(it->j == expected[i].j);
+    }
+}
+
+void test_patterns(int N)
+{
+    std::srand(N);
+    test_pattern(N, [](int i) { return i; });
+    test_pattern(N, [=](int i) { return N - i; });
+    test_pattern(N, [](int) { return 42; });
+    test_pattern(N, [](int) { return std::rand(); });
+    test_pattern(N, [](int) { return std::rand() % 4; });
+    test_pattern(N, [=](int i) { return i < N / 2 ? i : N - i; });
+    test_pattern(N, [](int i) { return i / 3 % 2 ? -i : i; });
+    // Timestamps with small perturbations
+    test_pattern(N, [](int i) { return i + std::rand() % 16; });
+    // Long runs in both directions, with ties across run boundaries
+    test_pattern(N, [](int i) { return (i / 500) % 2 ? 1000 - i % 500 : i % 500; });
+    test_pattern(N, [](int i) { return (i % 1000) / 10; });
+}
+
 int main()
 {
     // test null range
@@ -186,6 +233,11 @@ int main()
     test_larger_sorts(1000);
     test_larger_sorts(1009);
 
+    test_patterns(63);
+    test_patterns(64);
+    test_patterns(1000);
+    test_patterns(30001);
+
     // Check move-only types
     {
         std::vector<std::unique_ptr<int> > v(1000);
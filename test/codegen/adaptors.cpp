@@ -0,0 +1,147 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+// The iterators of the common adaptors must loop as tightly as the hand-written
+// loops they stand for, even where the optimizer can't see the view they came from
+// and the loop stores through a pointer that might alias it. See codegen.cmake.
+
+#include <vector>
+#include <cstddef>
+#include <functional>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/transform.hpp>
+
+using chars = std::vector<char>;
+using floats = std::vector<float>;
+
+struct is_space
+{
+    bool operator()(char ch) const
+    {
+        return ch == ' ';
+    }
+};
+
+using negate_iterator =
+    ranges::range_iterator_t<ranges::transform_view<floats const &, std::negate<float>>>;
+using remove_if_iterator =
+    ranges::range_iterator_t<ranges::remove_if_view<chars const &, is_space>>;
+
+// Empty, trivial functions take no space in the iterators.
+static_assert(sizeof(negate_iterator) == sizeof(floats::const_iterator), "");
+static_assert(sizeof(remove_if_iterator) == 2 * sizeof(chars::const_iterator), "");
+
+extern "C" void raw_transform(floats const &v, float *out)
+{
+    for(float f : v)
+        *out++ = f * 2.f;
+}
+
+extern "C" void range_transform(floats const &v, float *out)
+{
+    auto rng = v | ranges::view::transform([](float f) { return f * 2.f; });
+    ranges::copy(rng, out);
+}
+
+extern "C" void raw_transform_view(floats const &v, char *out)
+{
+    for(float f : v)
+        *out++ = (char)-f;
+}
+
+// The function is empty, so the iterators are bare vector iterators.
+extern "C" void range_transform_view(
+    ranges::transform_view<floats const &, std::negate<float>> &rng, char *out)
+{
+    for(auto it = rng.begin(), end = rng.end(); it != end; ++it)
+        *out++ = (char)*it;
+}
+
+extern "C" std::ptrdiff_t raw_remove_if(chars const &v, char *out)
+{
+    char *o = out;
+    auto it = v.begin(), end = v.end();
+    for(; it != end && *it == ' '; ++it)
+        ;
+    while(it != end)
+    {
+        *o++ = *it;
+        for(++it; it != end && *it == ' '; ++it)
+            ;
+    }
+    return o - out;
+}
+
+// Copying the whole view would go through remove_copy_if, which filters numbers
+// without branching, so copy between its iterators to see how they loop.
+extern "C" std::ptrdiff_t range_remove_if(chars const &v, char *out)
+{
+    auto rng = v | ranges::view::remove_if(is_space{});
+    return ranges::copy(rng.begin(), rng.end(), out).second - out;
+}
+
+// A pair of iterators into a remove_if_view each know where the base range ends:
+// they mustn't reload it from the view after each store to out, which may alias it.
+extern "C" std::ptrdiff_t raw_remove_if_iterators(char const *it, char const *base_end,
+    char const *end, char *out)
+{
+    char *o = out;
+    while(it != end)
+    {
+        *o++ = *it;
+        for(++it; it != base_end && *it == ' '; ++it)
+            ;
+    }
+    return o - out;
+}
+
+extern "C" std::ptrdiff_t range_remove_if_iterators(remove_if_iterator it,
+    remove_if_iterator end, char *out)
+{
+    return ranges::copy(it, end, out).second - out;
+}
+
+extern "C" std::ptrdiff_t raw_remove_if_transform(floats const &v, float *out)
+{
+    float *o = out;
+    auto it = v.begin(), end = v.end();
+    for(; it != end && *it < 0.f; ++it)
+        ;
+    while(it != end)
+    {
+        *o++ = *it * 2.f;
+        for(++it; it != end && *it < 0.f; ++it)
+            ;
+    }
+    return o - out;
+}
+
+extern "C" std::ptrdiff_t range_remove_if_transform(floats const &v, float *out)
+{
+    auto rng = v | ranges::view::remove_if([](float f) { return f < 0.f; })
+                 | ranges::view::transform([](float f) { return f * 2.f; });
+    return ranges::copy(rng, out).second - out;
+}
+
+extern "C" void raw_take_transform(floats const &v, std::ptrdiff_t n, float *out)
+{
+    for(std::ptrdiff_t i = 0; i < n; ++i)
+        out[i] = v[i] * 2.f;
+}
+
+extern "C" void range_take_transform(floats const &v, std::ptrdiff_t n, float *out)
+{
+    auto rng = v | ranges::view::transform([](float f) { return f * 2.f; })
+                 | ranges::view::take(n);
+    ranges::copy(rng, out);
+}
@@ -0,0 +1,48 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+// Ranges made bounded for the standard algorithms must loop as tightly as the
+// hand-written loops they stand for. See codegen.cmake.
+
+#include <numeric>
+#include <cstddef>
+#include <algorithm>
+#include <range/v3/view/bounded.hpp>
+#include <range/v3/view/counted.hpp>
+#include "c_str.hpp"
+
+extern "C" long raw_counted(int const *p, std::ptrdiff_t n)
+{
+    return std::accumulate(p, p + n, 0L);
+}
+
+// The bounded view's iterators are the counted view's own.
+extern "C" long range_counted(int const *p, std::ptrdiff_t n)
+{
+    auto rng = ranges::view::counted(p, n) | ranges::view::bounded;
+    return std::accumulate(rng.begin(), rng.end(), 0L);
+}
+
+extern "C" std::ptrdiff_t raw_c_str(char const *sz)
+{
+    std::ptrdiff_t n = 0;
+    for(; *sz; ++sz)
+        n += *sz == ',';
+    return n;
+}
+
+// The sentinel has no state, so the bounded view's iterators hold a flag rather than
+// a variant.
+extern "C" std::ptrdiff_t range_c_str(char const *sz)
+{
+    auto rng = c_str{sz} | ranges::view::bounded;
+    return std::count(rng.begin(), rng.end(), ',');
+}
@@ -0,0 +1,55 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#ifndef RANGES_TEST_CODEGEN_C_STR_HPP
+#define RANGES_TEST_CODEGEN_C_STR_HPP
+
+#include <range/v3/range_facade.hpp>
+
+// A null-terminated string, ended by its cursor's done().
+struct c_str
+  : ranges::range_facade<c_str>
+{
+private:
+    friend ranges::range_access;
+    char const *sz_;
+    struct cursor
+    {
+        char const *sz_;
+        char current() const
+        {
+            return *sz_;
+        }
+        void next()
+        {
+            ++sz_;
+        }
+        bool done() const
+        {
+            return *sz_ == 0;
+        }
+        bool equal(cursor const &that) const
+        {
+            return sz_ == that.sz_;
+        }
+    };
+    cursor begin_cursor() const
+    {
+        return {sz_};
+    }
+public:
+    c_str() = default;
+    c_str(char const *sz)
+      : sz_(sz)
+    {}
+};
+
+#endif
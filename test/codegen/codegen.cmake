@@ -0,0 +1,92 @@
+# Range v3 library
+#
+#  Copyright Eric Niebler 2014
+#
+#  Use, modification and distribution is subject to the
+#  Boost Software License, Version 1.0. (See accompanying
+#  file LICENSE_1_0.txt or copy at
+#  http://www.boost.org/LICENSE_1_0.txt)
+#
+# Project home: https://github.com/ericniebler/range-v3
+#
+
+# Checks that range code optimizes as well as the hand-written loop it replaces:
+#
+#     cmake -DCXX=<compiler> -DFLAGS=<flags> -DINCLUDE_DIR=<dir> -DSOURCE=<file>
+#           -DOUTPUT=<file> -P codegen.cmake
+#
+# SOURCE defines pairs of extern "C" functions, raw_<name> and range_<name>. It is
+# compiled to assembly with optimizations on and assertions off, and the loops of
+# each range_<name> may have no more instructions than those of raw_<name>.
+
+separate_arguments(flags UNIX_COMMAND "${FLAGS}")
+execute_process(
+  COMMAND ${CXX} ${flags} -O2 -DNDEBUG -fno-asynchronous-unwind-tables -I${INCLUDE_DIR}
+    -S -o ${OUTPUT} ${SOURCE}
+  RESULT_VARIABLE result
+  ERROR_VARIABLE errors)
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "${SOURCE} does not compile:\n${errors}")
+endif()
+
+file(READ ${OUTPUT} assembly)
+# Semicolons would split the lines of the list below.
+string(REPLACE ";" "," assembly "${assembly}")
+string(REPLACE "\n" ";" lines "${assembly}")
+
+# The instructions of each function, from its label to its .size directive, skipping
+# directives. A backward jump to one of the function's labels closes a loop, and the
+# instructions from the label to the jump are counted as the loop's.
+set(function)
+set(functions)
+foreach(line ${lines})
+  if(line MATCHES "^_?(raw|range)_([A-Za-z0-9_]+):")
+    set(function ${CMAKE_MATCH_1}_${CMAKE_MATCH_2})
+    list(APPEND functions ${function})
+    set(count_${function} 0)
+    set(loop_${function} 0)
+    set(code_${function} "")
+    set(labels)
+  elseif(NOT function)
+  elseif(line MATCHES "^[ \t]+\\.size[ \t]")
+    set(function)
+  elseif(line MATCHES "^(\\.?L[A-Za-z0-9_]+):")
+    list(APPEND labels ${CMAKE_MATCH_1})
+    set(label_${CMAKE_MATCH_1} ${count_${function}})
+    set(code_${function} "${code_${function}}${line}\n")
+  elseif(line MATCHES "^[ \t]+[a-z]")
+    math(EXPR count_${function} "${count_${function}} + 1")
+    set(code_${function} "${code_${function}}${line}\n")
+    if(line MATCHES "^[ \t]+(j[a-z]*|b[a-z.]*)[ \t]+(\\.?L[A-Za-z0-9_]+)$")
+      list(FIND labels ${CMAKE_MATCH_2} backward)
+      if(NOT backward EQUAL -1)
+        math(EXPR loop_${function}
+          "${loop_${function}} + ${count_${function}} - ${label_${CMAKE_MATCH_2}}")
+      endif()
+    endif()
+  endif()
+endforeach()
+
+# Compare the loops, which is where the time goes. Outside them the compiler is free
+# to lay out the code differently, so the totals are only reported.
+set(failures 0)
+foreach(function ${functions})
+  if(function MATCHES "^range_(.*)$")
+    set(raw raw_${CMAKE_MATCH_1})
+    set(summary "${loop_${function}} loop instructions, ${count_${function}} in all")
+    if(NOT DEFINED count_${raw})
+      message("${function}: there is no ${raw} to compare it with")
+      math(EXPR failures "${failures} + 1")
+    elseif(loop_${function} GREATER loop_${raw})
+      message("${function}: ${summary}, but ${raw} has ${loop_${raw}} loop instructions"
+        "\n${raw}:\n${code_${raw}}${function}:\n${code_${function}}")
+      math(EXPR failures "${failures} + 1")
+    else()
+      message("${function}: ${summary} (${raw}: ${loop_${raw}}, ${count_${raw}})")
+    endif()
+  endif()
+endforeach()
+
+if(failures)
+  message(FATAL_ERROR "${failures} codegen check(s) failed")
+endif()
@@ -0,0 +1,119 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+// Finite integer sequences must iterate as plain integers: no checks for overflow or
+// infinity, and nothing in the loop but the counter. See codegen.cmake.
+
+#include <cstddef>
+#include <range/v3/range_for.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/repeat.hpp>
+#include <range/v3/view/repeat_n.hpp>
+
+extern "C" long raw_iota(int n)
+{
+    long sum = 0;
+    for(int i = 0; i < n; ++i)
+        sum += i * 3;
+    return sum;
+}
+
+extern "C" long range_iota(int n)
+{
+    long sum = 0;
+    // The bounds are closed, so an empty sequence has none.
+    if(n > 0)
+        RANGES_FOR(int i, ranges::view::iota(0, n - 1))
+            sum += i * 3;
+    return sum;
+}
+
+extern "C" long raw_ints(int n)
+{
+    long sum = 0;
+    for(int i = 0; i < n; ++i)
+        sum += i * 3;
+    return sum;
+}
+
+extern "C" long range_ints(int n)
+{
+    long sum = 0;
+    if(n > 0)
+        for(int i : ranges::view::ints(0, n - 1))
+            sum += i * 3;
+    return sum;
+}
+
+extern "C" long raw_iota_take(int n)
+{
+    long sum = 0;
+    for(int i = 0; i < n; ++i)
+        sum += i * 3;
+    return sum;
+}
+
+extern "C" long range_iota_take(int n)
+{
+    long sum = 0;
+    RANGES_FOR(int i, ranges::view::iota(0) | ranges::view::take(n))
+        sum += i * 3;
+    return sum;
+}
+
+extern "C" std::size_t raw_iota_size_t(std::size_t n)
+{
+    std::size_t sum = 0;
+    for(std::size_t i = 0; i != n; ++i)
+        sum += i ^ (i >> 3);
+    return sum;
+}
+
+extern "C" std::size_t range_iota_size_t(std::size_t n)
+{
+    std::size_t sum = 0;
+    RANGES_FOR(std::size_t i, ranges::view::iota(std::size_t(0)) | ranges::view::take(n))
+        sum += i ^ (i >> 3);
+    return sum;
+}
+
+extern "C" long raw_repeat_n(int x, std::size_t n)
+{
+    long sum = 0;
+    for(std::size_t i = 0; i != n; ++i)
+        sum += x;
+    return sum;
+}
+
+extern "C" long range_repeat_n(int x, std::size_t n)
+{
+    long sum = 0;
+    RANGES_FOR(int i, ranges::view::repeat_n(x, n))
+        sum += i;
+    return sum;
+}
+
+extern "C" long raw_repeat_take(int x, int n)
+{
+    long sum = 0;
+    for(int i = 0; i < n; ++i)
+        sum += x;
+    return sum;
+}
+
+extern "C" long range_repeat_take(int x, int n)
+{
+    long sum = 0;
+    RANGES_FOR(int i, ranges::view::repeat(x) | ranges::view::take(n))
+        sum += i;
+    return sum;
+}
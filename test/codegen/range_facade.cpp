@@ -0,0 +1,107 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+// Ranges built with range_facade must loop as tightly as the hand-written loops
+// they stand for: the iterator, sentinel and cursor layers must all melt away.
+// See codegen.cmake.
+
+#include <istream>
+#include <range/v3/range_for.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/delimit.hpp>
+#include <range/v3/view/generate.hpp>
+#include "c_str.hpp"
+
+extern "C" long raw_c_str(char const *sz)
+{
+    long sum = 0;
+    for(; *sz; ++sz)
+        sum += *sz;
+    return sum;
+}
+
+extern "C" long range_c_str(char const *sz)
+{
+    long sum = 0;
+    RANGES_FOR(char ch, c_str{sz})
+        sum += ch;
+    return sum;
+}
+
+extern "C" long raw_c_str_for_each(char const *sz)
+{
+    long sum = 0;
+    for(; *sz; ++sz)
+        sum += *sz;
+    return sum;
+}
+
+extern "C" long range_c_str_for_each(char const *sz)
+{
+    long sum = 0;
+    c_str rng{sz};
+    ranges::for_each(rng, [&](char ch){ sum += ch; });
+    return sum;
+}
+
+extern "C" long raw_delimit(int const *p)
+{
+    long sum = 0;
+    for(; *p != -1; ++p)
+        sum += *p;
+    return sum;
+}
+
+extern "C" long range_delimit(int const *p)
+{
+    long sum = 0;
+    RANGES_FOR(int i, ranges::view::delimit(p, -1))
+        sum += i;
+    return sum;
+}
+
+extern "C" long raw_generate(int n)
+{
+    long sum = 0;
+    int x = 0;
+    for(int i = 0; i < n; ++i)
+        sum += (x = x * 7 + 1);
+    return sum;
+}
+
+extern "C" long range_generate(int n)
+{
+    long sum = 0;
+    int x = 0;
+    RANGES_FOR(int i, ranges::view::generate([&]{ return x = x * 7 + 1; }) | ranges::view::take(n))
+        sum += i;
+    return sum;
+}
+
+extern "C" long raw_istream(std::istream &sin)
+{
+    long sum = 0;
+    int i;
+    while(sin >> i)
+        sum += i;
+    return sum;
+}
+
+extern "C" long range_istream(std::istream &sin)
+{
+    long sum = 0;
+    RANGES_FOR(int i, ranges::istream<int>(sin))
+        sum += i;
+    return sum;
+}
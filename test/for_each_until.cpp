@@ -0,0 +1,187 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/for_each_until.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/empty.hpp>
+#include <range/v3/view/single.hpp>
+#include <range/v3/view/for_each.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/take_while.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/algorithm/all_of.hpp>
+#include <range/v3/algorithm/any_of.hpp>
+#include <range/v3/algorithm/count.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/algorithm/none_of.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+// Collects the elements pushed to it, and stops after a given number.
+template<typename T>
+struct collect
+{
+    std::vector<T> &out;
+    std::size_t max;
+    bool operator()(T const &t) const
+    {
+        out.push_back(t);
+        return out.size() < max;
+    }
+};
+
+template<typename T, typename Rng>
+std::pair<std::vector<T>, bool> push_all(Rng && rng, std::size_t max = (std::size_t)-1)
+{
+    std::vector<T> out;
+    bool const done = ranges::for_each_until(rng, collect<T>{out, max});
+    return {std::move(out), done};
+}
+
+int main()
+{
+    using namespace ranges;
+
+    // Ranges with no for_each_until member are walked with their iterators:
+    {
+        std::list<int> l{1, 2, 3, 4};
+        auto r = push_all<int>(l);
+        CHECK(r.second);
+        ::check_equal(r.first, {1, 2, 3, 4});
+        r = push_all<int>(l, 2);
+        CHECK(!r.second);
+        ::check_equal(r.first, {1, 2});
+        CHECK(for_each_until(std::vector<int>{}, [](int) { return false; }));
+    }
+
+    // The views that yield pushes:
+    {
+        ::check_equal(push_all<int>(view::single(42)).first, {42});
+        ::check_equal(push_all<int>(yield_if(true, 7)).first, {7});
+        CHECK(push_all<int>(yield_if(false, 7)).first.empty());
+        ::check_equal(push_all<int>(view::repeat_n(3, 4)).first, {3, 3, 3, 3});
+        int i = 0;
+        ::check_equal(push_all<int>(lazy_yield_if(true, [&]{ return ++i; })).first, {1});
+        CHECK(push_all<int>(lazy_yield_if(false, [&]{ return ++i; })).first.empty());
+        CHECK(i == 1);
+        // They push what their iterators yield: for these, prvalues that can be moved
+        std::vector<std::string> strs;
+        auto sink = [&](std::string &&str) { strs.push_back(std::move(str)); return true; };
+        CHECK(for_each_until(view::single(std::string("a")), sink));
+        CHECK(for_each_until(view::repeat_n(std::string("b"), 2), sink));
+        ::check_equal(strs, {"a", "b", "b"});
+        auto r = push_all<int>(view::empty<int>());
+        CHECK(r.second);
+        CHECK(r.first.empty());
+    }
+
+    // A join pushes the elements of each inner range in turn:
+    {
+        std::vector<std::vector<int>> vv{{1, 2}, {}, {3}, {}, {4, 5, 6}};
+        auto r = push_all<int>(vv | view::join);
+        CHECK(r.second);
+        ::check_equal(r.first, {1, 2, 3, 4, 5, 6});
+        r = push_all<int>(vv | view::join, 4);
+        CHECK(!r.second);
+        ::check_equal(r.first, {1, 2, 3, 4});
+    }
+
+    // Comprehensions run as nested loops, and can be stopped early even when they
+    // are infinite:
+    {
+        auto triples =
+            view::for_each(view::ints(1), [](int z)
+            {
+                return view::for_each(view::ints(1, z), [=](int x)
+                {
+                    return view::for_each(view::ints(x, z), [=](int y)
+                    {
+                        return yield_if(x*x + y*y == z*z, std::make_tuple(x, y, z));
+                    });
+                });
+            });
+        auto r = push_all<std::tuple<int, int, int>>(triples, 3);
+        CHECK(!r.second);
+        ::check_equal(r.first, {std::make_tuple(3, 4, 5), std::make_tuple(6, 8, 10),
+            std::make_tuple(5, 12, 13)});
+
+        auto squares = view::for_each(view::ints(1, 4), [](int i)
+        {
+            return yield_from(view::repeat_n(i, (std::size_t)i));
+        });
+        ::check_equal(push_all<int>(squares).first, {1, 2, 2, 3, 3, 3, 4, 4, 4, 4});
+        CHECK(accumulate(squares, 0) == 30);
+    }
+
+    // Adaptors push their base range's elements through themselves:
+    {
+        std::list<int> l{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+        auto rng = l | view::transform([](int i) { return i * 10; })
+                     | view::remove_if([](int i) { return i % 20 == 0; })
+                     | view::take_while([](int i) { return i < 80; });
+        auto r = push_all<int>(rng);
+        CHECK(r.second);
+        ::check_equal(r.first, {10, 30, 50, 70});
+        r = push_all<int>(rng, 2);
+        CHECK(!r.second);
+        ::check_equal(r.first, {10, 30});
+
+        auto r2 = push_all<int>(l | view::take(3));
+        CHECK(r2.second);
+        ::check_equal(r2.first, {1, 2, 3});
+        r2 = push_all<int>(l | view::take(3), 3);
+        CHECK(!r2.second);
+        ::check_equal(r2.first, {1, 2, 3});
+        CHECK(push_all<int>(l | view::take(0), 0).second);
+        // take_while ends the view on the element it rejects, without pushing it:
+        CHECK(push_all<int>(l | view::take_while([](int i) { return i < 4; }), 4).second);
+        CHECK(!push_all<int>(l | view::take_while([](int i) { return i < 4; }), 3).second);
+
+        CHECK(accumulate(rng, 0) == 160);
+        CHECK(count(rng, 30) == 1);
+        CHECK(count_if(rng, [](int i) { return i > 20; }) == 3);
+        CHECK(all_of(rng, [](int i) { return i % 20 != 0; }));
+        CHECK(!all_of(rng, [](int i) { return i < 70; }));
+        CHECK(any_of(rng, [](int i) { return i == 70; }));
+        CHECK(!any_of(rng, [](int i) { return i == 90; }));
+        CHECK(none_of(rng, [](int i) { return i == 90; }));
+    }
+
+    // ...including when the base is a comprehension, which is then run as nested loops:
+    {
+        auto pairs = view::for_each(view::ints(1), [](int i)
+        {
+            return view::for_each(view::ints(1, i), [=](int j)
+            {
+                return yield(std::make_pair(i, j));
+            });
+        });
+        auto sums = pairs | view::transform([](std::pair<int, int> p) { return p.first + p.second; })
+                          | view::remove_if([](int i) { return i % 2 != 0; })
+                          | view::take(5);
+        auto r = push_all<int>(sums);
+        CHECK(r.second);
+        ::check_equal(r.first, {2, 4, 4, 6, 6});
+        CHECK(accumulate(sums, 0) == 22);
+        CHECK(any_of(pairs | view::take_while([](std::pair<int, int> p) { return p.first < 100; }),
+            [](std::pair<int, int> p) { return p.first == 99 && p.second == 99; }));
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,72 @@
+# Range v3 library
+#
+#  Copyright Eric Niebler 2014
+#
+#  Use, modification and distribution is subject to the
+#  Boost Software License, Version 1.0. (See accompanying
+#  file LICENSE_1_0.txt or copy at
+#  http://www.boost.org/LICENSE_1_0.txt)
+#
+# Project home: https://github.com/ericniebler/range-v3
+#
+
+# Compiles every public header on its own and checks what it costs to include:
+#
+#     cmake -DCXX=<compiler> -DFLAGS=<flags> -DINCLUDE_DIR=<dir> -DWORK_DIR=<dir> -P headers.cmake
+#
+# Each header must compile by itself, and may pull in the expensive standard headers
+# below only if it's one of the headers listed for it. A TU that uses a single view
+# or algorithm should pay only for what it uses. Needs a compiler that supports -H
+# (GCC or Clang).
+
+set(heavy_headers regex random iostream istream ostream sstream fstream locale)
+
+set(allowed_regex
+  range/v3/all.hpp range/v3/view.hpp range/v3/view/tokenize.hpp)
+# <regex> includes these.
+set(allowed_sstream ${allowed_regex})
+set(allowed_locale ${allowed_regex})
+set(allowed_istream ${allowed_regex})
+set(allowed_ostream ${allowed_regex})
+set(allowed_random
+  range/v3/all.hpp range/v3/algorithm.hpp range/v3/view.hpp
+  range/v3/algorithm/random_shuffle.hpp range/v3/algorithm/sample.hpp
+  range/v3/algorithm/shuffle.hpp range/v3/utility/random.hpp range/v3/view/sample.hpp)
+set(allowed_iostream)
+set(allowed_fstream)
+
+separate_arguments(flags UNIX_COMMAND "${FLAGS}")
+file(GLOB_RECURSE headers RELATIVE ${INCLUDE_DIR} ${INCLUDE_DIR}/range/*.hpp)
+list(SORT headers)
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+set(failures 0)
+foreach(header ${headers})
+  if(header MATCHES "/detail/")
+    continue()
+  endif()
+  string(MAKE_C_IDENTIFIER ${header} name)
+  set(source ${WORK_DIR}/${name}.cpp)
+  file(WRITE ${source} "#include <${header}>\n")
+  execute_process(
+    COMMAND ${CXX} ${flags} -I${INCLUDE_DIR} -fsyntax-only -H ${source}
+    RESULT_VARIABLE result
+    OUTPUT_VARIABLE output
+    ERROR_VARIABLE output)
+  if(NOT result EQUAL 0)
+    message("${header}: does not compile by itself:\n${output}")
+    math(EXPR failures "${failures} + 1")
+    continue()
+  endif()
+  foreach(heavy ${heavy_headers})
+    list(FIND allowed_${heavy} ${header} allowed)
+    if(allowed EQUAL -1 AND output MATCHES "(^|\n)\\.+ [^\n]*/${heavy}(\n|$)")
+      message("${header}: includes <${heavy}>")
+      math(EXPR failures "${failures} + 1")
+    endif()
+  endforeach()
+endforeach()
+
+if(failures)
+  message(FATAL_ERROR "${failures} header check(s) failed")
+endif()
@@ -0,0 +1,99 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <memory>
+#include <string>
+#include <sstream>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/priority_queue.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+struct timer
+{
+    int deadline;
+    std::string name;
+};
+
+int main()
+{
+    using namespace ranges;
+
+    {
+        priority_queue<int> q;
+        CHECK(q.empty());
+        std::vector<int> v(1000);
+        for(int &i : v)
+        {
+            i = std::rand() % 100;
+            q.push(i);
+        }
+        CHECK(q.size() == v.size());
+        std::sort(v.begin(), v.end(), std::greater<int>());
+        for(int i : v)
+        {
+            CHECK(q.top() == i);
+            q.pop();
+        }
+        CHECK(q.empty());
+    }
+
+    // Earliest deadline first, with a projection
+    {
+        priority_queue<timer, std::greater<int>, int timer::*> q{std::greater<int>{}, &timer::deadline};
+        q.push(timer{30, "c"});
+        q.emplace(timer{10, "a"});
+        q.push(timer{20, "b"});
+        CHECK(q.top().name == "a");
+        ::check_equal(q.drain() | view::transform(&timer::name), {"a", "b", "c"});
+        CHECK(q.empty());
+    }
+
+    // Build from a range and drain part of it
+    {
+        std::vector<int> v = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+        priority_queue<int, ordered_less, ident, 2> q{v};
+        CHECK(q.size() == v.size());
+        ::check_equal(q.drain() | view::take(4), {9, 6, 5, 5});
+        // each element taken has been popped
+        CHECK(q.size() == v.size() - 4);
+        CHECK(q.pop_top() == 5);
+        ::check_equal(q.drain(), {4, 3, 3, 2, 1, 1});
+        CHECK(q.empty());
+    }
+
+    // Build from a range whose sentinel isn't an iterator
+    {
+        std::stringstream sin{"3 1 4 1 5"};
+        priority_queue<int> q{istream<int>(sin)};
+        ::check_equal(q.drain(), {5, 4, 3, 1, 1});
+    }
+
+    // Move-only elements
+    {
+        priority_queue<std::unique_ptr<int>, std::less<int>,
+            int &(*)(std::unique_ptr<int> const &), 8> q{std::less<int>{},
+                [](std::unique_ptr<int> const &p) -> int & { return *p; }};
+        for(int i = 0; i < 100; ++i)
+            q.push(std::unique_ptr<int>(new int(i * 37 % 100)));
+        for(int i = 99; i >= 0; --i)
+            CHECK(*q.pop_top() == i);
+    }
+
+    return ::test_result();
+}
@@ -15,6 +15,7 @@
 #include <range/v3/to_container.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/transform.hpp>
+#include <range/v3/view/counted.hpp>
 #include <range/v3/action/sort.hpp>
 #include "./simple_test.hpp"
 #include "./test_utils.hpp"
@@ -38,5 +39,11 @@ int main()
     static_assert((bool)Same<decltype(vec1), std::vector<long>>(), "");
     ::check_equal(vec1, {81,64,49,36,25,16,9,4,1,0});
 
+    // Sized random-access ranges are copied through their own iterators:
+    std::vector<int> vec2{4,3,2,1,0};
+    auto vec3 = view::counted(vec2.begin(), 3) | to_vector;
+    static_assert((bool)Same<decltype(vec3), std::vector<int>>(), "");
+    ::check_equal(vec3, {4,3,2});
+
     return ::test_result();
 }
@@ -0,0 +1,46 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <range/v3/utility/safe_int.hpp>
+#include "../simple_test.hpp"
+
+using namespace ranges;
+
+int main()
+{
+    using I = safe_int<int>;
+
+    I i = 41;
+    CHECK((i++ == 41));
+    CHECK((i == 42));
+    CHECK((i-- == 42));
+    CHECK((i == 41));
+
+    // Infinities absorb increments and finite additions, and NaN compares unequal to
+    // everything.
+    I inf = I::inf();
+    CHECK((inf++ == I::inf()));
+    CHECK((inf == I::inf()));
+    CHECK((-inf + 1 == -I::inf()));
+    CHECK((inf + -inf).is_NaN());
+    CHECK((I::NaN() != I::NaN()));
+    CHECK(!(I::NaN() == I::NaN()));
+
+    // Overflow saturates to infinity.
+    I big = std::numeric_limits<int>::max() - 1;
+    CHECK((big + 1 == I::inf()));
+    CHECK((big * 2 == I::inf()));
+    CHECK((-big * 2 == -I::inf()));
+    CHECK((I{7} / 0 == I::inf()));
+    CHECK((I{7} % 3 == 1));
+
+    return ::test_result();
+}
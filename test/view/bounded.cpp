@@ -12,6 +12,7 @@
 #include <list>
 #include <vector>
 #include <sstream>
+#include <algorithm>
 #include <range/v3/core.hpp>
 #include <range/v3/view/bounded.hpp>
 #include <range/v3/view/delimit.hpp>
@@ -61,5 +62,19 @@ int main()
     // Pass-through of already-bounded ranges is OK:
     rng3 = rng3 | view::bounded;
 
+    // A sized random-access range's end is computed from its size, so its iterators
+    // can be used as they are:
+    std::vector<int> v2{9,8,7,6,5,4,3,2,1,0};
+    auto rng4 = view::counted(v2.begin(), 8) | view::bounded;
+    ::models<concepts::BoundedRange>(rng4);
+    ::models<concepts::SizedRange>(rng4);
+    CONCEPT_ASSERT(Same<range_iterator_t<decltype(rng4)>,
+                        range_iterator_t<decltype(view::counted(v2.begin(), 8))>>());
+    CHECK((end(rng4) - begin(rng4)) == 8);
+    std::sort(begin(rng4), end(rng4));
+    ::check_equal(v2, {2,3,4,5,6,7,8,9,1,0});
+    auto const & crng4 = rng4;
+    ::check_equal(crng4, {2,3,4,5,6,7,8,9});
+
     return ::test_result();
 }
@@ -0,0 +1,71 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <range/v3/core.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/distinct.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/take.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct unhashable
+{
+    int i;
+    bool operator==(unhashable that) const { return i == that.i; }
+    bool operator!=(unhashable that) const { return i != that.i; }
+};
+
+int main()
+{
+    using namespace ranges;
+
+    int a[] = {3, 1, 3, 2, 1, 4, 3, 2, 5};
+    auto rng = a | view::distinct;
+    ::models<concepts::InputRange>(rng);
+    ::models_not<concepts::ForwardRange>(rng);
+    ::check_equal(rng, {3, 1, 2, 4, 5});
+    // begin() starts over
+    ::check_equal(rng, {3, 1, 2, 4, 5});
+
+    // With a projection; the first element with each key is kept
+    std::vector<std::string> words = {"apple", "avocado", "banana", "blueberry", "cherry", "apricot"};
+    ::check_equal(words | view::distinct([](std::string const &s) { return s[0]; }),
+        {"apple", "banana", "cherry"});
+    ::check_equal(view::distinct(words, &std::string::size),
+        {"apple", "avocado", "banana", "blueberry"});
+
+    // Lots of keys, to make the table grow
+    {
+        std::vector<int> v;
+        for(int i = 0; i < 10000; ++i)
+            v.push_back((i * 7919) % 2500);
+        std::vector<int> d = v | view::distinct;
+        CHECK(d.size() == 2500u);
+        ::check_equal(d, v | view::transform([](int i) { return i; }) | view::take(2500));
+    }
+
+    // Input ranges
+    {
+        std::stringstream sin{"b a b c a d"};
+        ::check_equal(istream<std::string>(sin) | view::distinct, {"b", "a", "c", "d"});
+    }
+
+    // Keys must be hashable
+    CONCEPT_ASSERT(!view::distinct_fn::Concept<std::vector<unhashable> &, ident>());
+    CONCEPT_ASSERT(view::distinct_fn::Concept<std::vector<unhashable> &,
+        int unhashable::*>());
+
+    return ::test_result();
+}
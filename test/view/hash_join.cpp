@@ -0,0 +1,121 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <utility>
+#include <range/v3/core.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/single.hpp>
+#include <range/v3/view/hash_join.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct customer
+{
+    int id;
+    std::string name;
+};
+
+struct order
+{
+    int customer_id;
+    char item;
+};
+
+int main()
+{
+    using namespace ranges;
+    using P = std::pair<int, int>;
+    auto to_pair = [](P p) { return p; };
+
+    std::vector<customer> customers = {{3, "carol"}, {1, "alice"}, {2, "bob"}, {1, "al"}};
+    std::vector<order> orders = {{2, 'x'}, {4, 'y'}, {1, 'z'}, {3, 'w'}, {2, 'v'}};
+
+    auto j = view::hash_join(customers, orders, &customer::id, &order::customer_id);
+    ::models<concepts::Range>(j);
+    ::models<concepts::ForwardIterator>(j.begin());
+    ::models_not<concepts::BidirectionalIterator>(j.begin());
+    CONCEPT_ASSERT(Same<range_reference_t<decltype(j)>, std::pair<customer &, order &>>());
+    CONCEPT_ASSERT(Same<range_value_t<decltype(j)>, std::pair<customer, order>>());
+
+    // In the order of the probe range, then of the build range.
+    std::vector<std::pair<std::string, char>> res;
+    RANGES_FOR(auto p, j)
+        res.emplace_back(p.first.name, p.second.item);
+    CHECK(res == (std::vector<std::pair<std::string, char>>{{"bob", 'x'}, {"alice", 'z'},
+        {"al", 'z'}, {"carol", 'w'}, {"bob", 'v'}}));
+
+    // The references refer to the elements of the underlying ranges, and the index is
+    // built only once.
+    CHECK(&(*j.begin()).first == &customers[2]);
+    CHECK(&(*j.begin()).second == &orders[0]);
+    (*j.begin()).second.item = 'X';
+    CHECK(orders[0].item == 'X');
+
+    // Pipe syntax, with a key of a different type on the probe side
+    std::vector<long> keys = {5, 0, 5, 7};
+    auto k = view::iota(0, 5) | view::hash_join(keys, ident{}, [](long l) { return l; });
+    ::check_equal(view::transform(k, [](std::pair<int, long &> p) {
+        return P{p.first, int(p.second)}; }), {P{5, 5}, P{0, 0}, P{5, 5}});
+
+    // No matches, and empty inputs
+    int odd[] = {1, 3, 5};
+    int even[] = {0, 2, 4, 6};
+    auto n = view::hash_join(odd, even);
+    CHECK(n.begin() == n.end());
+    std::vector<int> e;
+    auto n2 = view::hash_join(e, even);
+    CHECK(n2.begin() == n2.end());
+    auto n3 = view::hash_join(odd, e);
+    CHECK(n3.begin() == n3.end());
+
+    // A single-pass probe range
+    std::stringstream sin{"2 7 3 2 1"};
+    int b[] = {3, 2, 2};
+    auto s = view::hash_join(b, istream<int>(sin));
+    ::models_not<concepts::ForwardIterator>(s.begin());
+    ::check_equal(view::transform(s, to_pair), {P{2, 2}, P{2, 2}, P{3, 3}, P{2, 2}, P{2, 2}});
+
+    // Many keys, each matching twice
+    std::vector<int> big;
+    for(int i = 0; i < 1000; ++i)
+        big.push_back(i % 500);
+    auto m = view::hash_join(big, view::iota(0, 999));
+    int count = 0;
+    RANGES_FOR(auto p, m)
+    {
+        CHECK(p.first == p.second);
+        ++count;
+    }
+    CHECK(count == 1000);
+
+    // A copy made after the first begin() outlives the view, whose build range owns
+    // its element.
+    {
+        using J = decltype(view::hash_join(view::single(2), view::iota(0, 3)));
+        std::unique_ptr<J> orig{new J{view::hash_join(view::single(2), view::iota(0, 3))}};
+        ::check_equal(view::transform(*orig, to_pair), {P{2, 2}});
+        J copy = *orig;
+        J moved = std::move(*orig);
+        orig.reset();
+        ::check_equal(view::transform(copy, to_pair), {P{2, 2}});
+        ::check_equal(view::transform(moved, to_pair), {P{2, 2}});
+        copy = moved;
+        ::check_equal(view::transform(copy, to_pair), {P{2, 2}});
+    }
+
+    return test_result();
+}
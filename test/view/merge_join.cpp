@@ -0,0 +1,83 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <utility>
+#include <range/v3/core.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/merge_join.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+    using P = std::pair<int, int>;
+    auto to_pair = [](P p) { return p; };
+
+    std::pair<int, char> orders[] = {{1, 'a'}, {2, 'b'}, {2, 'c'}, {4, 'd'}, {7, 'e'}};
+    std::pair<int, std::string> names[] = {{0, "zero"}, {2, "two"}, {2, "deux"}, {3, "three"},
+        {4, "four"}, {7, "seven"}, {9, "nine"}};
+
+    auto j = view::merge_join(orders, names, ordered_less{}, &std::pair<int, char>::first,
+        &std::pair<int, std::string>::first);
+    ::models<concepts::Range>(j);
+    ::models<concepts::ForwardIterator>(j.begin());
+    ::models_not<concepts::BidirectionalIterator>(j.begin());
+    CONCEPT_ASSERT(Same<range_reference_t<decltype(j)>,
+        std::pair<std::pair<int, char> &, std::pair<int, std::string> &>>());
+    CONCEPT_ASSERT(Same<range_value_t<decltype(j)>,
+        std::pair<std::pair<int, char>, std::pair<int, std::string>>>());
+
+    // Every pair with equal keys; runs of equal keys on both sides give their product.
+    std::vector<std::pair<char, std::string>> res;
+    RANGES_FOR(auto p, j)
+        res.emplace_back(p.first.second, p.second.second);
+    CHECK(res == (std::vector<std::pair<char, std::string>>{{'b', "two"}, {'b', "deux"},
+        {'c', "two"}, {'c', "deux"}, {'d', "four"}, {'e', "seven"}}));
+
+    // The references refer to the elements of the underlying ranges.
+    CHECK(&(*j.begin()).first == &orders[1]);
+    CHECK(&(*j.begin()).second == &names[1]);
+
+    // Pipe syntax, and duplicates on the left only
+    int a[] = {1, 1, 3, 5, 5, 5, 8};
+    auto k = a | view::merge_join(view::iota(0, 6));
+    ::check_equal(view::transform(k, to_pair), {P{1, 1}, P{1, 1}, P{3, 3}, P{5, 5}, P{5, 5}, P{5, 5}});
+
+    // No matches, and empty inputs
+    int odd[] = {1, 3, 5};
+    int even[] = {0, 2, 4, 6};
+    CHECK(view::merge_join(odd, even).begin() == view::merge_join(odd, even).end());
+    std::vector<int> e;
+    CHECK(view::merge_join(e, even).begin() == view::merge_join(e, even).end());
+    CHECK(view::merge_join(odd, e).begin() == view::merge_join(odd, e).end());
+
+    // Descending order with a custom comparison
+    int d1[] = {9, 7, 7, 4};
+    int d2[] = {8, 7, 4, 4, 2};
+    auto greater = [](int x, int y) { return x > y; };
+    ::check_equal(view::transform(view::merge_join(d1, d2, greater), to_pair),
+        {P{7, 7}, P{7, 7}, P{4, 4}, P{4, 4}});
+
+    // A single-pass first range
+    std::stringstream sin{"1 2 2 5 6"};
+    int b[] = {2, 3, 5, 5};
+    auto s = view::merge_join(istream<int>(sin), b);
+    ::models_not<concepts::ForwardIterator>(s.begin());
+    ::check_equal(view::transform(s, to_pair), {P{2, 2}, P{2, 2}, P{5, 5}, P{5, 5}});
+
+    return test_result();
+}
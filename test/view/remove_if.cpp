@@ -9,9 +9,12 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <set>
+#include <vector>
 #include <iterator>
 #include <functional>
 #include <range/v3/core.hpp>
+#include <range/v3/algorithm/copy.hpp>
 #include <range/v3/view/remove_if.hpp>
 #include <range/v3/view/counted.hpp>
 #include <range/v3/view/reverse.hpp>
@@ -78,5 +81,23 @@ int main()
     CONCEPT_ASSERT(Range<decltype(mutable_rng)>());
     CONCEPT_ASSERT(!Range<decltype(mutable_rng) const>());
 
+    // Copying out of a filtered vector goes through remove_copy_if
+    std::vector<int> big(1000);
+    for(int i = 0; i < 1000; ++i)
+        big[i] = i;
+    auto && rng4 = big | view::remove_if(is_odd());
+    std::vector<int> evens;
+    auto res = ranges::copy(rng4, ranges::back_inserter(evens));
+    CHECK(res.first == end(rng4));
+    CHECK(evens.size() == 500u);
+    CHECK(evens.front() == 0);
+    CHECK(evens.back() == 998);
+    std::vector<int> evens2 = rng4;
+    CHECK(evens2 == evens);
+    std::set<int> evens3 = rng4;
+    CHECK(evens3.size() == 500u);
+    ::check_equal(evens3 | to_<std::vector>(), evens);
+    CHECK((rng4 | to_<std::set>()) == evens3);
+
     return test_result();
 }
@@ -0,0 +1,73 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <random>
+#include <vector>
+#include <cstdlib>
+#include <range/v3/core.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/sample.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/algorithm/adjacent_find.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+    std::mt19937 gen;
+
+    // n distinct elements, in their original order
+    {
+        std::vector<int> v = view::ints(0, 999);
+        auto rng = v | view::sample(10, gen);
+        ::models<concepts::InputRange>(rng);
+        ::models_not<concepts::ForwardRange>(rng);
+        std::vector<int> s = rng;
+        CHECK(s.size() == 10u);
+        CHECK(is_sorted(s));
+        CHECK(adjacent_find(s) == s.end());
+        // each traversal draws a new sample
+        std::vector<int> s2 = rng;
+        CHECK(s2.size() == 10u);
+        CHECK(s != s2);
+    }
+
+    // Asking for more than there is yields everything
+    {
+        std::list<int> l = {1, 2, 3};
+        ::check_equal(view::sample(l, 5, gen), {1, 2, 3});
+        auto none = view::sample(l, 0, gen);
+        CHECK(none.begin() == none.end());
+    }
+
+    // Each element is equally likely to be chosen
+    {
+        int counts[20] = {};
+        auto evens = view::ints(0, 39) | view::remove_if([](int i) { return i % 2 != 0; });
+        for(int t = 0; t < 20000; ++t)
+            RANGES_FOR(int i, evens | view::sample(5, gen))
+                ++counts[i / 2];
+        for(int c : counts)
+            CHECK(std::abs(c - 5000) < 400);
+    }
+
+    // The per-thread generator
+    {
+        std::vector<int> s = view::ints(0, 99) | view::sample(7);
+        CHECK(s.size() == 7u);
+        CHECK(is_sorted(s));
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,121 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <vector>
+#include <utility>
+#include <range/v3/core.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/set_algorithm.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/zip.hpp>
+#include <range/v3/algorithm/set_algorithm.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct first_fn
+{
+    template<typename Pair>
+    int operator()(Pair const &p) const
+    {
+        return std::get<0>(p);
+    }
+};
+
+struct second_fn
+{
+    template<typename Pair>
+    char operator()(Pair const &p) const
+    {
+        return std::get<1>(p);
+    }
+};
+
+int main()
+{
+    using namespace ranges;
+
+    int a[] = {1, 2, 2, 3, 3, 3, 4, 4, 4, 4};
+    int b[] = {2, 4, 4, 6};
+
+    auto u = view::set_union(a, b);
+    ::models<concepts::Range>(u);
+    ::models<concepts::ForwardIterator>(u.begin());
+    ::models_not<concepts::BidirectionalIterator>(u.begin());
+    ::check_equal(u, {1, 2, 2, 3, 3, 3, 4, 4, 4, 4, 6});
+
+    auto i = view::set_intersection(a, b);
+    ::models<concepts::ForwardIterator>(i.begin());
+    ::check_equal(i, {2, 4, 4});
+
+    auto d = view::set_difference(a, b);
+    ::check_equal(d, {1, 2, 3, 3, 3, 4, 4});
+    ::check_equal(view::set_difference(b, a), {6});
+
+    auto sd = view::set_symmetric_difference(a, b);
+    ::check_equal(sd, {1, 2, 3, 3, 3, 4, 4, 6});
+
+    // Pipe syntax
+    ::check_equal(a | view::set_intersection(b), {2, 4, 4});
+    ::check_equal(view::iota(0, 9) | view::set_difference(b), {0, 1, 3, 5, 7, 8, 9});
+
+    // Empty inputs
+    std::vector<int> e;
+    ::check_equal(view::set_union(e, b), {2, 4, 4, 6});
+    ::check_equal(view::set_union(b, e), {2, 4, 4, 6});
+    CHECK(view::set_intersection(a, e).begin() == view::set_intersection(a, e).end());
+    ::check_equal(view::set_symmetric_difference(e, b), {2, 4, 4, 6});
+
+    // Custom comparison and projections
+    std::pair<int, char> pa[] = {{1, 'a'}, {3, 'b'}, {5, 'c'}};
+    int keys[] = {5, 3};
+    ::check_equal(view::set_intersection(pa, keys | view::reverse, ordered_less{},
+        &std::pair<int, char>::first) | view::transform(&std::pair<int, char>::second),
+        {'b', 'c'});
+    ::check_equal(view::set_union(b | view::reverse, a | view::reverse, std::greater<int>()),
+        {6, 4, 4, 4, 4, 3, 3, 3, 2, 2, 1});
+
+    // Galloping through a much longer range gives the same answer as the
+    // eager algorithm.
+    std::vector<int> big;
+    for(int x = 0; x < 10000; ++x)
+        big.push_back(x * 3);
+    std::vector<int> small{-1, 0, 7, 9, 2998, 2999, 3000, 29997, 30000};
+    std::vector<int> expected;
+    set_intersection(small, big, back_inserter(expected));
+    ::check_equal(view::set_intersection(big, small), expected);
+    ::check_equal(view::set_intersection(small, big), expected);
+    expected.clear();
+    set_difference(small, big, back_inserter(expected));
+    ::check_equal(view::set_difference(small, big), expected);
+
+    // Proxy iterators, long enough to gallop
+    {
+        std::vector<char> chars(big.size(), 'x');
+        chars[3] = 'a';
+        chars[1000] = 'b';
+        std::vector<char> small_chars(small.size(), 'y');
+        auto z = view::set_intersection(view::zip(big, chars), view::zip(small, small_chars),
+            ordered_less{}, first_fn{}, first_fn{});
+        ::check_equal(z | view::transform(first_fn{}), {0, 9, 3000, 29997});
+        ::check_equal(z | view::transform(second_fn{}), {'x', 'a', 'b', 'x'});
+    }
+
+    // Input ranges
+    auto ia = make_range(::input_iterator<int const *>(begin(a)),
+        ::input_iterator<int const *>(end(a)));
+    auto iu = view::set_union(ia, b);
+    ::models<concepts::InputIterator>(iu.begin());
+    ::models_not<concepts::ForwardIterator>(iu.begin());
+    ::check_equal(iu, {1, 2, 2, 3, 3, 3, 4, 4, 4, 4, 6});
+
+    return test_result();
+}
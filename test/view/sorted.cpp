@@ -0,0 +1,136 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/sorted.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/algorithm/random_shuffle.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct keyed
+{
+    int key;
+    char ch;
+};
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v = view::ints(0,999);
+    random_shuffle(v);
+
+    // In memory, as a single run
+    {
+        auto rng = v | view::sorted;
+        ::models<concepts::InputRange>(rng);
+        ::models_not<concepts::ForwardRange>(rng);
+        CHECK(equal(rng, view::ints(0,999)));
+        // begin() starts over
+        CHECK(equal(rng, view::ints(0,999)));
+        ::check_equal(view::sorted(v, std::greater<int>()) | view::take(3), {999,998,997});
+        std::vector<int> none;
+        CHECK(empty(none | view::sorted));
+    }
+
+    // Spilled to temporary files in runs of 16 elements, and merged
+    {
+        auto rng = v | view::sorted(16 * sizeof(int));
+        CHECK(equal(rng, view::ints(0,999)));
+        CHECK(equal(rng, view::ints(0,999)));
+        // Copies share the spilled runs but merge them independently
+        auto it = begin(rng);
+        ++it;
+        auto copy = rng;
+        auto it2 = begin(copy);
+        CHECK(*it2 == 0);
+        CHECK(*it == 1);
+        ++it2;
+        ++it2;
+        ++it;
+        CHECK(*it2 == 2);
+        CHECK(*it == 2);
+        CHECK(equal(copy, view::ints(0,999)));
+        ::check_equal(v | view::sorted(sizeof(int), std::greater<int>()) | view::take(3),
+            {999,998,997});
+    }
+
+    // More runs than are merged at once: runs of 4 elements make 1000 of them
+    {
+        std::vector<int> w;
+        for(int i = 0; i < 4; ++i)
+            w.insert(w.end(), v.begin(), v.end());
+        auto rng = w | view::sorted(4 * sizeof(int));
+        std::vector<int> out;
+        for(auto it = begin(rng); it != end(rng); ++it)
+            out.push_back(*it);
+        CHECK(out.size() == 4000u);
+        CHECK(is_sorted(out));
+        CHECK(out.front() == 0);
+        CHECK(out.back() == 999);
+        // 1000 runs make 15 of the next level, so most elements are written twice
+        CHECK(rng.spilled_bytes() == (4000u + 15u * 64u * 4u) * sizeof(int));
+    }
+
+    // Runs of one element make 5000 runs, merged in three levels. Each element is
+    // written at most three times, where merging every run at once whenever there
+    // are too many would write them about 40 times.
+    {
+        std::vector<int> w;
+        for(int i = 0; i < 5; ++i)
+            w.insert(w.end(), v.begin(), v.end());
+        auto rng = w | view::sorted(sizeof(int));
+        std::vector<int> out;
+        for(auto it = begin(rng); it != end(rng); ++it)
+            out.push_back(*it);
+        CHECK(out.size() == 5000u);
+        CHECK(is_sorted(out));
+        CHECK(rng.spilled_bytes() == (5000u + 78u * 64u + 64u * 64u) * sizeof(int));
+    }
+
+    // Sorted by a projection, and spilled
+    {
+        std::vector<keyed> p{{1,'a'},{3,'b'},{0,'c'},{4,'d'},{2,'e'}};
+        auto rng = p | view::sorted(2 * sizeof(keyed), ordered_less{}, &keyed::key);
+        std::string s;
+        for(auto it = begin(rng); it != end(rng); ++it)
+            s.push_back((*it).ch);
+        CHECK(s == "caebd");
+    }
+
+    // Types that can't be spilled are sorted in memory
+    {
+        std::vector<std::string> s{"pear", "apple", "fig", "kiwi"};
+        ::check_equal(s | view::sorted, {"apple", "fig", "kiwi", "pear"});
+        std::vector<std::pair<int, char>> p{{1,'a'},{0,'b'}};
+        ::check_equal(view::sorted(p, ordered_less{}, &std::pair<int, char>::first)
+            | view::transform(&std::pair<int, char>::second), {'b', 'a'});
+    }
+
+    // Input ranges
+    {
+        std::stringstream sin{"3 1 4 1 5 9 2 6 5 3 5"};
+        ::check_equal(istream<int>(sin) | view::sorted(3 * sizeof(int)),
+            {1,1,2,3,3,4,5,5,5,6,9});
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,56 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <range/v3/core.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/top_k.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/algorithm/random_shuffle.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v = view::ints(0,999);
+    random_shuffle(v);
+
+    auto rng = v | view::top_k(5);
+    ::models<concepts::BoundedRange>(rng);
+    ::models<concepts::RandomAccessRange>(rng);
+    ::check_equal(rng, {999,998,997,996,995});
+    CHECK(size(rng) == 5u);
+    // The elements are kept by the view
+    ::check_equal(rng, {999,998,997,996,995});
+
+    ::check_equal(view::top_k(v, 3, [](int i){return -i;}), {0,1,2});
+    CHECK(empty(v | view::top_k(0)));
+    CHECK(size(view::ints(0,3) | view::top_k(10)) == 4u);
+
+    // Ranked by a projection
+    std::vector<std::pair<int, char>> p{{1,'a'},{3,'b'},{0,'c'},{4,'d'},{2,'e'}};
+    ::check_equal(p | view::top_k(3, &std::pair<int, char>::first) |
+            view::transform(&std::pair<int, char>::second),
+        {'d','b','e'});
+
+    // Input ranges
+    {
+        std::stringstream sin{"3 1 4 1 5 9 2 6 5 3 5"};
+        ::check_equal(istream<int>(sin) | view::top_k(4), {9,6,5,5});
+    }
+
+    return ::test_result();
+}